@@ -0,0 +1,131 @@
+// ------------------------------------------------------------------
+// LCC KOMŞU TARAMASI BENCHMARK'I
+// ------------------------------------------------------------------
+// checkTimeouts/runLCCLogic taramasını üç yolla ölçer:
+//   map    : eski std::map döngüsü (süre aşımı + üye sayısı + en düşük CH)
+//   scalar : lccScanNeighborsScalar (bit maskesi üzerinden)
+//   avx2   : lccScanAvx2Kernel() (CPU destekliyorsa)
+// Her boyutta üç sonucun aynı olduğu da kontrol edilir.
+// Girdi düzeni simülasyondakiyle aynıdır: checkTimeouts çekirdeğe
+// neighborsLastSeen.data() (id ile indekslenen raw int64, beacon işlenirken
+// yazılır) ve keys().words() dizilerini kopyasız verir; olmayan id'lerde eski
+// değerler kalır. Ölçülen süre checkTimeouts'taki taramanın tamamıdır.
+//
+// Derleme (OMNeT++ gerekmez), LCC_project klasöründen:
+//   g++ -O2 -std=c++17 -Isrc benchmarks/scan_bench.cc src/LccScan.cc -o scan_bench
+//   ./scan_bench [doluluk=0.5] [süre_aşımı_oranı=0.1]
+
+#include "LccScan.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace inet;
+
+struct Scenario
+{
+    int n;
+    std::vector<int64_t> lastSeen;     // LccNodeIdMap<int64_t> değer dizisi
+    std::vector<int> roles;
+    std::vector<uint64_t> present;     // LccNodeIdSet kelimeleri
+    std::map<int, int64_t> lastSeenMap;
+    std::map<int, int> rolesMap;
+    int64_t expiryBefore;
+};
+
+static Scenario makeScenario(int n, double occupancy, double expiredFraction, std::mt19937_64& rng)
+{
+    Scenario s;
+    s.n = n;
+    s.lastSeen.assign(n, 0);
+    s.roles.assign(n, 0);
+    s.present.assign((n + 63) / 64, 0);
+    s.expiryBefore = 1000000;
+    std::uniform_real_distribution<double> u(0, 1);
+    for (int id = 0; id < n; id++) {
+        // Mevcut olmayan id'lerde de çöp değer bırak (maske testi için)
+        s.lastSeen[id] = u(rng) < 0.5 ? 0 : 2000000;
+        s.roles[id] = (int)(rng() % 3);
+        if (u(rng) >= occupancy) continue;
+        s.lastSeen[id] = u(rng) < expiredFraction ? s.expiryBefore - 1 - (int64_t)(rng() % 1000) : s.expiryBefore + (int64_t)(rng() % 1000);
+        s.present[id >> 6] |= uint64_t(1) << (id & 63);
+        s.lastSeenMap[id] = s.lastSeen[id];
+        s.rolesMap[id] = s.roles[id];
+    }
+    return s;
+}
+
+struct Aggregate { int numExpired; int numMembers; int lowestHead; };
+
+// Eski yol: map'i gez, süresi dolanları say, kalanlarda üye sayısı ve en düşük CH
+static Aggregate mapScan(const Scenario& s)
+{
+    Aggregate a{0, 0, -1};
+    for (auto const& [id, lastSeen] : s.lastSeenMap) {
+        if (lastSeen < s.expiryBefore) { a.numExpired++; continue; }
+        int role = s.rolesMap.at(id);
+        if (role == 1) a.numMembers++;
+        else if (role == 2 && a.lowestHead < 0) a.lowestHead = id;
+    }
+    return a;
+}
+
+static Aggregate kernelScan(LccScanKernel kernel, const Scenario& s, LccNeighborScan& scan)
+{
+    kernel(s.lastSeen.data(), s.roles.data(), s.present.data(), s.n, s.expiryBefore, scan);
+    return Aggregate{scan.numExpired, scan.numMembers, lccMaskNext(scan.heads, 0)};
+}
+
+template<class F>
+static double nsPerCall(F f, int iterations)
+{
+    volatile int sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) sink += f().numMembers;
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+int main(int argc, char **argv)
+{
+    double occupancy = argc > 1 ? atof(argv[1]) : 0.5;
+    double expiredFraction = argc > 2 ? atof(argv[2]) : 0.1;
+    LccScanKernel avx2 = lccScanAvx2Kernel();
+    std::mt19937_64 rng(1);
+
+    printf("occupancy=%.2f expired=%.2f kernel=%s\n", occupancy, expiredFraction, lccScanKernelName());
+    printf("%6s %12s %12s %12s %10s %10s\n", "n", "map(ns)", "scalar(ns)", "avx2(ns)", "map/avx2", "sc/avx2");
+
+    for (int n = 8; n <= 1024; n *= 2) {
+        Scenario s = makeScenario(n, occupancy, expiredFraction, rng);
+        LccNeighborScan scan;
+        Aggregate ref = mapScan(s);
+        Aggregate sc = kernelScan(lccScanNeighborsScalar, s, scan);
+        if (sc.numExpired != ref.numExpired || sc.numMembers != ref.numMembers || sc.lowestHead != ref.lowestHead) {
+            fprintf(stderr, "scalar kernel mismatch at n=%d\n", n);
+            return 1;
+        }
+        LccNeighborScan scalarScan = scan;
+        if (avx2) {
+            kernelScan(avx2, s, scan);
+            if (scan.expired != scalarScan.expired || scan.members != scalarScan.members || scan.heads != scalarScan.heads) {
+                fprintf(stderr, "avx2 kernel mismatch at n=%d\n", n);
+                return 1;
+            }
+        }
+
+        int iterations = std::max(1000, 4000000 / n);
+        double tMap = nsPerCall([&] { return mapScan(s); }, iterations);
+        double tScalar = nsPerCall([&] { return kernelScan(lccScanNeighborsScalar, s, scan); }, iterations);
+        double tAvx2 = avx2 ? nsPerCall([&] { return kernelScan(avx2, s, scan); }, iterations) : 0;
+        if (avx2)
+            printf("%6d %12.1f %12.1f %12.1f %10.2f %10.2f\n", n, tMap, tScalar, tAvx2, tMap / tAvx2, tScalar / tAvx2);
+        else
+            printf("%6d %12.1f %12.1f %12s %10s %10s\n", n, tMap, tScalar, "-", "-", "-");
+    }
+    return 0;
+}
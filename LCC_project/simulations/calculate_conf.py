@@ -1,106 +1,153 @@
 import pandas as pd
 import numpy as np
 import scipy.stats as stats
+import subprocess
 import sys
 
 # Dosya Adı
-filename = "manual_results.csv"
+filename = sys.argv[1] if len(sys.argv) > 1 else "manual_results.csv"
 scenario_name = "Simulation Results"
 
-try:
-    # 1. Sütun İsimleri
-    cols = ["NodeID", "Sent", "Received", "PDR", "AvgDelay", "Throughput", "BeaconsSent", "RoleChanges"]
-    
-    # Dosyayı oku
-    df = pd.read_csv(filename, header=None, names=cols)
-    
+# 1. Sütun İsimleri
+cols = ["NodeID", "Sent", "Received", "PDR", "AvgDelay", "Throughput", "BeaconsSent", "RoleChanges",
+        "DropTtl", "DropDuplicate", "DropNoRoute", "DropNoCh"]
+drop_cols = cols[8:]
+
+metrics_map = {
+    "Global_PDR": "PDR (%)",
+    "Avg_Delay": "Gecikme (ms)",  # Etiketi değiştirdik
+    "Total_Throughput": "Throughput (bps)",
+    "Total_Overhead": "Overhead (Paket Sayisi)",
+    "Avg_Stability": "Stabilite (Rol Degisimi)",
+    "DropTtl": "Drop: Hop Limit",
+    "DropDuplicate": "Drop: Duplicate",
+    "DropNoRoute": "Drop: Rota Yok",
+    "DropNoCh": "Drop: CH Yok"
+}
+
+
+def load_runs(path):
+    # Dosyayı oku, NodeID == 0 satırlarından run'lara böl
+    df = pd.read_csv(path, header=None, names=cols)
+
     df["RoleChanges"] = df["RoleChanges"].fillna(0)
+    df[drop_cols] = df[drop_cols].fillna(0)  # eski (8 sütunlu) satırlar
 
     # --- Node Sayısı ve Run Sayısı Tespiti ---
     zero_indices = df[df["NodeID"] == 0].index
-    
+
     if len(zero_indices) > 1:
-        NODE_COUNT = zero_indices[1] - zero_indices[0]
+        node_count = zero_indices[1] - zero_indices[0]
         num_runs = len(zero_indices)
-    elif len(zero_indices) == 1:
-        NODE_COUNT = len(df)
-        num_runs = 1
     else:
-        NODE_COUNT = len(df)
+        node_count = len(df)
         num_runs = 1
 
-    print(f"Tespit Edilen Node Sayısı: {NODE_COUNT}")
-    print(f"Toplam Run Sayısı: {num_runs}")
-
-    # --- METRİKLERİ HESAPLA ---
-    results = {
-        "Global_PDR": [],
-        "Avg_Delay": [],
-        "Total_Throughput": [],
-        "Total_Overhead": [],
-        "Avg_Stability": [] 
-    }
-
+    chunks = []
     for i in range(num_runs):
         start_idx = zero_indices[i] if len(zero_indices) > i else 0
         end_idx = zero_indices[i+1] if (i + 1) < len(zero_indices) else len(df)
-        
-        chunk = df.iloc[start_idx:end_idx]
-        
-        # 1. Global PDR
-        total_sent = chunk["Sent"].sum()
-        total_recv = chunk["Received"].sum()
-        pdr = (total_recv / total_sent * 100) if total_sent > 0 else 0
-        results["Global_PDR"].append(pdr)
-        
-        # 2. Weighted Average Delay (ms Cinsinden)
-        weighted_delay_sum = (chunk["AvgDelay"] * chunk["Received"]).sum()
-        if total_recv > 0:
-            avg_delay_sec = weighted_delay_sum / total_recv
-            # Saniyeyi Milisaniyeye Çeviriyoruz (* 1000)
-            results["Avg_Delay"].append(avg_delay_sec * 1000.0) 
-        else:
-            results["Avg_Delay"].append(0)
-            
-        # 3. Throughput
-        total_thr = chunk["Throughput"].sum()
-        results["Total_Throughput"].append(total_thr)
-        
-        # 4. Overhead
-        total_beacon = chunk["BeaconsSent"].sum()
-        results["Total_Overhead"].append(total_beacon)
-        
-        # 5. Stability
-        avg_stability = chunk["RoleChanges"].mean()
-        results["Avg_Stability"].append(avg_stability)
-
-    # --- İSTATİSTİKLERİ YAZDIR ---
-    print("\n" + "="*60)
-    print(f" SONUÇ RAPORU: {scenario_name}")
-    print("="*60)
-    
-    metrics_map = {
-        "Global_PDR": "PDR (%)",
-        "Avg_Delay": "Gecikme (ms)",  # Etiketi değiştirdik
-        "Total_Throughput": "Throughput (bps)",
-        "Total_Overhead": "Overhead (Paket Sayisi)",
-        "Avg_Stability": "Stabilite (Rol Degisimi)"
-    }
-    
-    for key, label in metrics_map.items():
-        data = results[key]
-        if not data: continue
-            
-        mean_val = np.mean(data)
-        
-        if num_runs > 1:
-            std_err = stats.sem(data)
-            h = std_err * stats.t.ppf((1 + 0.95) / 2., num_runs - 1)
-            print(f"{label:25} : {mean_val:.4f} ± {h:.4f}")
-        else:
-            print(f"{label:25} : {mean_val:.4f} (Tek Run)")
-
-    print("="*60)
-
-except Exception as e:
-    print("Hata:", e)
+        chunks.append(df.iloc[start_idx:end_idx])
+    return node_count, chunks
+
+
+def compute_run_metrics(chunk):
+    results = {}
+
+    # 1. Global PDR
+    total_sent = chunk["Sent"].sum()
+    total_recv = chunk["Received"].sum()
+    results["Global_PDR"] = (total_recv / total_sent * 100) if total_sent > 0 else 0
+
+    # 2. Weighted Average Delay (ms Cinsinden)
+    weighted_delay_sum = (chunk["AvgDelay"] * chunk["Received"]).sum()
+    if total_recv > 0:
+        avg_delay_sec = weighted_delay_sum / total_recv
+        # Saniyeyi Milisaniyeye Çeviriyoruz (* 1000)
+        results["Avg_Delay"] = avg_delay_sec * 1000.0
+    else:
+        results["Avg_Delay"] = 0
+
+    # 3. Throughput
+    results["Total_Throughput"] = chunk["Throughput"].sum()
+
+    # 4. Overhead
+    results["Total_Overhead"] = chunk["BeaconsSent"].sum()
+
+    # 5. Stability
+    results["Avg_Stability"] = chunk["RoleChanges"].mean()
+
+    # 6. Drop Nedenleri (run toplamı)
+    for col in drop_cols:
+        results[col] = chunk[col].sum()
+    return results
+
+
+def confidence_interval(data, level=0.95):
+    # Student-t güven aralığı yarı genişliği (tek run için None)
+    mean_val = np.mean(data)
+    if len(data) < 2:
+        return mean_val, None
+    std_err = stats.sem(data)
+    return mean_val, std_err * stats.t.ppf((1 + level) / 2., len(data) - 1)
+
+
+# ------------------------------------------------------------------
+# OMNeT++ RUN YARDIMCILARI (replicate / saturation_search / parallel_runs / compare_builds)
+# ------------------------------------------------------------------
+def add_run_arguments(parser, exe=True):
+    # Binary ve NED yolu: tüm run betiklerinde ortak
+    if exe:
+        parser.add_argument("--exe", default="../LCC_project", help="simülasyon binary'si")
+    parser.add_argument("--ned-path", default="..:../../inet-4.5.4/src")
+
+
+def opp_run_command(exe, ned_path, config, run, result_prefix, options=()):
+    # Cmdenv + express mode, kolon kaydı kapalı; sonuçlar <result_prefix>_results.csv
+    return [exe, "-u", "Cmdenv", "-c", config, "-r", str(run), "-n", ned_path,
+            "--cmdenv-express-mode=true",
+            "--*.recordColumns=false",
+            f'--**.app[0].resultFilePrefix="{result_prefix}"',
+            *options,
+            "omnetpp.ini"]
+
+
+def run_simulation(exe, ned_path, config, run, result_prefix, options=()):
+    # Tek run'ı koşturur (çıktı gösterilmez, hata olursa CalledProcessError)
+    cmd = opp_run_command(exe, ned_path, config, run, result_prefix, options)
+    subprocess.run(cmd, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+
+
+if __name__ == "__main__":
+    try:
+        node_count, chunks = load_runs(filename)
+        num_runs = len(chunks)
+
+        print(f"Tespit Edilen Node Sayısı: {node_count}")
+        print(f"Toplam Run Sayısı: {num_runs}")
+
+        # --- METRİKLERİ HESAPLA ---
+        results = {key: [] for key in metrics_map}
+        for chunk in chunks:
+            for key, value in compute_run_metrics(chunk).items():
+                results[key].append(value)
+
+        # --- İSTATİSTİKLERİ YAZDIR ---
+        print("\n" + "="*60)
+        print(f" SONUÇ RAPORU: {scenario_name}")
+        print("="*60)
+
+        for key, label in metrics_map.items():
+            data = results[key]
+            if not data: continue
+
+            mean_val, h = confidence_interval(data)
+            if h is not None:
+                print(f"{label:25} : {mean_val:.4f} ± {h:.4f}")
+            else:
+                print(f"{label:25} : {mean_val:.4f} (Tek Run)")
+
+        print("="*60)
+
+    except Exception as e:
+        print("Hata:", e)
@@ -0,0 +1,76 @@
+import argparse
+import os
+import re
+import sys
+import tempfile
+
+from calculate_conf import add_run_arguments, run_simulation
+
+# Trace record / replay tutarlılık kontrolü: önce kayıt config'i, sonra aynı
+# trace dosyalarıyla replay config'i koşturulur ve seçilen LCC skalerleri
+# node bazında karşılaştırılır. Replay kayıttan ayrışırsa (eksik kayıt tipi,
+# RNG kayması ...) farklı node'lar listelenir ve çıkış kodu 1 olur.
+#
+# Kullanım: python3 check_replay.py [-r 0]
+#           python3 check_replay.py --record Trace_Record_Reports --replay Trace_Replay_Reports \
+#               --scalars clusterCastsSent,clusterCastDiscarded
+
+parser = argparse.ArgumentParser(description="LCC trace replay consistency check")
+parser.add_argument("--record", default="Trace_Record_Handover", help="kayıt config'i")
+parser.add_argument("--replay", default="Trace_Replay_Handover", help="replay config'i")
+parser.add_argument("-r", "--run", type=int, default=0, help="run numarası")
+add_run_arguments(parser)
+parser.add_argument("--scalars", default="chHandovers,chOutage:count,roleChanges:count",
+                    help="karşılaştırılacak app[0] skalerleri")
+
+SCALAR_LINE = re.compile(r'^scalar\s+(\S+)\s+("[^"]*"|\S+)\s+(\S+)')
+
+
+def load_scalars(path, names):
+    # .sca: "scalar <modül> <isim> <değer>" satırları; sadece app[0] modülleri
+    values = {}
+    with open(path) as f:
+        for line in f:
+            match = SCALAR_LINE.match(line)
+            if not match:
+                continue
+            module, name, value = match.group(1), match.group(2).strip('"'), match.group(3)
+            if name in names and module.endswith(".app[0]"):
+                values[(module, name)] = float(value)
+    return values
+
+
+def run_config(args, config, workdir):
+    sca = os.path.join(workdir, config + ".sca")
+    run_simulation(args.exe, args.ned_path, config, args.run, os.path.join(workdir, config),
+                   [f"--output-scalar-file={sca}"])
+    return sca
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+    names = set(args.scalars.split(","))
+
+    with tempfile.TemporaryDirectory(prefix="lcc_replay_") as workdir:
+        recorded = load_scalars(run_config(args, args.record, workdir), names)
+        replayed = load_scalars(run_config(args, args.replay, workdir), names)
+
+    if not recorded:
+        sys.exit(f"{args.record}: skaler bulunamadı ({args.scalars}); scalar-recording açık mı?")
+
+    print(f"{args.record} -> {args.replay} (run {args.run})")
+    print("=" * 60)
+    mismatches = 0
+    for name in sorted(names):
+        keys = sorted(k for k in recorded if k[1] == name)
+        total_rec = sum(recorded[k] for k in keys)
+        total_rep = sum(replayed.get(k, 0) for k in keys)
+        diff = [k[0] for k in keys if replayed.get(k) != recorded[k]]
+        mismatches += len(diff)
+        status = "OK" if not diff else f"FARKLI ({len(diff)} node)"
+        print(f"{name:25} kayıt={total_rec:8.0f} replay={total_rep:8.0f}  {status}")
+        for module in diff:
+            print(f"    {module}: {recorded[(module, name)]:.0f} -> {replayed.get((module, name), float('nan')):.0f}")
+    print("=" * 60)
+    sys.exit(1 if mismatches else 0)
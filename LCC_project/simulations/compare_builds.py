@@ -0,0 +1,66 @@
+import argparse
+import os
+import re
+import subprocess
+import tempfile
+import time
+
+from calculate_conf import add_run_arguments, opp_run_command
+
+# Aynı run'ı farklı binary'lerle (örn. normal vs HEADLESS=1) ya da farklı
+# ini seçenekleriyle koşturup duvar saati süresini, event/s ve tepe RSS'i raporlar.
+# Varyant: "binary" veya "binary::--seçenek=değer::..."
+#
+# Kullanım: python3 compare_builds.py -c Nodes_60 ../LCC_project ../LCC_project_headless
+#           python3 compare_builds.py ../LCC_project "../LCC_project::--**.app[0].useChunkPool=false"
+
+parser = argparse.ArgumentParser(description="LCC build variant comparison")
+parser.add_argument("variants", nargs="+", help="karşılaştırılacak varyantlar (ilki referans)")
+parser.add_argument("-c", "--config", default="Nodes_60", help="omnetpp.ini config adı")
+parser.add_argument("-r", "--run", type=int, default=0, help="run numarası")
+add_run_arguments(parser, exe=False)
+parser.add_argument("--trials", type=int, default=3, help="binary başına tekrar (en iyisi alınır)")
+parser.add_argument("--log-level", type=int, default=0, help="LCC logLevel parametresi")
+
+
+def timed_run(args, exe, options, workdir):
+    cmd = opp_run_command(exe, args.ned_path, args.config, args.run, os.path.join(workdir, "bench"),
+                          [f"--**.app[0].logLevel={args.log_level}", *options])
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, text=True)
+    output = proc.stdout.read()
+    _, status, usage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter() - start
+    if status != 0:
+        raise SystemExit(f"Run başarısız: {' '.join(cmd)}")
+
+    # Cmdenv son durum satırı: "... event #N"
+    events = re.findall(r"[Ee]vent #(\d+)", output)
+    num_events = int(events[-1]) if events else 0
+    return elapsed, num_events, usage.ru_maxrss / 1024.0   # ru_maxrss: KiB (Linux)
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    variants = []
+    for spec in args.variants:
+        exe, *options = spec.split("::")
+        label = os.path.basename(exe) + ("".join(f" {o.split('.')[-1]}" for o in options))
+        variants.append((label, os.path.abspath(exe), options))
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    print(f"Senaryo: {args.config} run {args.run}, varyant başına {args.trials} tekrar (en iyisi)")
+    print("\n" + "=" * 80)
+    print(f"{'Varyant':36} {'Süre (s)':>10} {'Hızlanma':>9} {'Event/s':>12} {'Tepe RSS (MiB)':>15}")
+    print("=" * 80)
+
+    reference = None
+    with tempfile.TemporaryDirectory(prefix="lcc_bench_") as workdir:
+        for label, exe, options in variants:
+            trials = [timed_run(args, exe, options, workdir) for _ in range(args.trials)]
+            best, num_events, _ = min(trials)
+            peak_rss = max(t[2] for t in trials)
+            if reference is None:
+                reference = best
+            print(f"{label:36} {best:>10.2f} {reference / best:>9.2f} {num_events / best:>12.0f} {peak_rss:>15.1f}")
+    print("=" * 80)
@@ -0,0 +1,95 @@
+import csv
+import math
+import sys
+import numpy as np
+
+# LCC::finish her node için manual_sketches.csv'ye sketch dökümü ekler.
+# Bu script aynı run'a ait node sketch'lerini kovaları toplayarak birleştirir
+# ve ağ geneli p50 / p95 / p99 / p999 değerlerini yazdırır.
+
+filename = sys.argv[1] if len(sys.argv) > 1 else "manual_sketches.csv"
+QUANTILES = [0.50, 0.95, 0.99, 0.999]
+LABELS = ["p50", "p95", "p99", "p999"]
+UNITS = {"endToEndDelay": ("ms", 1000.0), "chLifetime": ("s", 1.0), "clusterSize": ("", 1.0),
+         "holdWait": ("ms", 1000.0)}
+
+
+class Sketch:
+    def __init__(self, min_value, max_value, rel_err):
+        self.min_value = min_value
+        self.gamma = (1 + rel_err) / (1 - rel_err)
+        self.count = 0
+        self.sum = 0.0
+        self.min = math.inf
+        self.max = -math.inf
+        self.zero = 0
+        self.buckets = {}
+
+    def merge_row(self, count, total, vmin, vmax, zero, buckets):
+        if count == 0:
+            return
+        self.count += count
+        self.sum += total
+        self.min = min(self.min, vmin)
+        self.max = max(self.max, vmax)
+        self.zero += zero
+        for item in buckets.split():
+            idx, cnt = item.split(":")
+            self.buckets[int(idx)] = self.buckets.get(int(idx), 0) + int(cnt)
+
+    def quantile(self, q):
+        # LccQuantileSketch::quantile ile aynı mantık
+        if self.count == 0:
+            return 0.0
+        rank = q * (self.count - 1)
+        cumulative = self.zero
+        if rank < cumulative:
+            return self.min
+        for idx in sorted(self.buckets):
+            cumulative += self.buckets[idx]
+            if rank < cumulative:
+                value = self.min_value * 2 * self.gamma ** (idx + 1) / (self.gamma + 1)
+                return min(max(value, self.min), self.max)
+        return self.max
+
+
+def read_runs(path):
+    # Run sınırı: NodeID == 0 olan ilk metrik satırı (calculate_conf.py ile aynı kabul)
+    runs = []
+    with open(path) as f:
+        for row in csv.reader(f):
+            if not row:
+                continue
+            node, metric = int(row[0]), row[1]
+            if node == 0 and (not runs or metric in runs[-1]):
+                runs.append({})
+            if not runs:
+                runs.append({})
+            min_value, max_value, rel_err = float(row[2]), float(row[3]), float(row[4])
+            sketch = runs[-1].setdefault(metric, Sketch(min_value, max_value, rel_err))
+            sketch.merge_row(int(row[5]), float(row[6]), float(row[7]), float(row[8]), int(row[9]),
+                             row[10] if len(row) > 10 else "")
+    return runs
+
+
+try:
+    runs = read_runs(filename)
+    print(f"Toplam Run Sayısı: {len(runs)}")
+
+    print("\n" + "=" * 72)
+    print(" AĞ GENELİ DAĞILIMLAR (run ortalaması)")
+    print("=" * 72)
+
+    metrics = sorted({m for run in runs for m in run})
+    for metric in metrics:
+        unit, scale = UNITS.get(metric, ("", 1.0))
+        per_run = np.array([[run[metric].quantile(q) * scale for q in QUANTILES]
+                            for run in runs if metric in run])
+        means = per_run.mean(axis=0)
+        cells = "  ".join(f"{label}={v:.4f}" for label, v in zip(LABELS, means))
+        print(f"{metric + (' (' + unit + ')' if unit else ''):25} : {cells}")
+
+    print("=" * 72)
+
+except Exception as e:
+    print("Hata:", e)
@@ -0,0 +1,74 @@
+import argparse
+import concurrent.futures
+import os
+import subprocess
+import tempfile
+import time
+
+from calculate_conf import add_run_arguments, run_simulation
+
+# Bir config'in tüm run'larını (repetition) N çekirdek üzerinde paralel koşturur
+# ve çekirdek sayısına göre hızlanmayı raporlar.
+#
+# Not: Sim ağı OMNeT++ parsim ile bölünmez; INET'in radyo ortamı tek bir modül
+# olduğu için host[] farklı partition'lara dağıtılamıyor. Tek makinede
+# çekirdekleri kullanmanın yolu bağımsız run'ları paralel koşturmaktır.
+#
+# Kullanım: python3 parallel_runs.py -c Nodes_60 [--cores 1,2,4,8] [--sim-time 30s]
+
+parser = argparse.ArgumentParser(description="LCC run-level parallel speedup")
+parser.add_argument("-c", "--config", required=True, help="omnetpp.ini config adı")
+add_run_arguments(parser)
+parser.add_argument("--runs", type=int, default=None, help="run sayısı (varsayılan: config'deki repeat)")
+parser.add_argument("--cores", default=None, help="denenecek çekirdek sayıları, örn. 1,2,4,8")
+parser.add_argument("--sim-time", default=None, help="sim-time-limit override")
+
+
+def count_runs(args):
+    out = subprocess.run([args.exe, "-u", "Cmdenv", "-c", args.config, "-n", args.ned_path,
+                          "-s", "-q", "numruns", "omnetpp.ini"],
+                         check=True, capture_output=True, text=True).stdout
+    return int(out.strip().split()[-1])
+
+
+def run_once(args, workdir, run):
+    options = [f"--sim-time-limit={args.sim_time}"] if args.sim_time else []
+    run_simulation(args.exe, args.ned_path, args.config, run, os.path.join(workdir, f"run{run}"), options)
+
+
+def timed_batch(args, runs, jobs):
+    with tempfile.TemporaryDirectory(prefix="lcc_par_") as workdir, \
+            concurrent.futures.ThreadPoolExecutor(max_workers=jobs) as pool:
+        start = time.perf_counter()
+        for f in [pool.submit(run_once, args, workdir, r) for r in range(runs)]:
+            f.result()
+        return time.perf_counter() - start
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    runs = args.runs if args.runs is not None else count_runs(args)
+    if args.cores:
+        core_counts = [int(c) for c in args.cores.split(",")]
+    else:
+        core_counts, c = [], 1
+        while c < os.cpu_count():
+            core_counts.append(c)
+            c *= 2
+        core_counts.append(os.cpu_count())
+
+    print(f"Senaryo: {args.config}, {runs} run")
+    print("\n" + "=" * 60)
+    print(f"{'Çekirdek':>10} {'Süre (s)':>12} {'Hızlanma':>10} {'Verim':>8}")
+    print("=" * 60)
+
+    baseline = None
+    for jobs in core_counts:
+        elapsed = timed_batch(args, runs, jobs)
+        if baseline is None:
+            baseline = elapsed * core_counts[0]
+        speedup = baseline / elapsed
+        print(f"{jobs:>10} {elapsed:>12.2f} {speedup:>10.2f} {speedup / jobs * 100:>7.1f}%")
+    print("=" * 60)
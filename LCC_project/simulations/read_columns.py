@@ -0,0 +1,69 @@
+import glob
+import struct
+import sys
+import numpy as np
+
+# LccColumnRecorder çıktısını mmap ile okur.
+# Kullanım: python3 read_columns.py results/Baseline-0 [signalName] [--csv out.csv]
+
+HEADER_SIZE = 16
+MAGIC = b"LCCCOL02"  # başlık: magic, uint32 elemSize, int32 simtime ölçek üssü
+
+
+def read_header(path):
+    # Başlığı doğrula; simtime ölçek üssünü döndür (raw * 10^üs = saniye)
+    with open(path, "rb") as f:
+        magic = f.read(8)
+        if magic == b"LCCCOL01":
+            raise ValueError(f"{path}: eski kolon formatı (simtime ölçeği yok), run'ı tekrar kaydedin")
+        if magic != MAGIC:
+            raise ValueError(f"{path}: LCC kolon dosyası değil")
+        _, scale_exp = struct.unpack("<Ii", f.read(8))
+    return scale_exp
+
+
+def open_column(path, dtype):
+    # Veri kısmını kopyalamadan eşle
+    read_header(path)
+    return np.memmap(path, dtype=dtype, mode="r", offset=HEADER_SIZE)
+
+
+def load_column(prefix, signal):
+    base = f"{prefix}.{signal}"
+    scale_exp = read_header(base + ".time")
+    times = open_column(base + ".time", np.int64)
+    nodes = open_column(base + ".node", np.int32)
+    values = open_column(base + ".value", np.float64)
+    n = min(len(times), len(nodes), len(values))  # yarım yazılmış kayıtları at
+    return times[:n] * 10.0 ** scale_exp, nodes[:n], values[:n]
+
+
+def list_signals(prefix):
+    return sorted(p[len(prefix) + 1:-len(".time")] for p in glob.glob(prefix + ".*.time"))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Kullanım: python3 read_columns.py <prefix> [signal] [--csv out.csv]")
+        sys.exit(1)
+
+    prefix = sys.argv[1]
+    csv_out = None
+    args = sys.argv[2:]
+    if "--csv" in args:
+        csv_out = args[args.index("--csv") + 1]
+        args = args[:args.index("--csv")]
+    signals = args if args else list_signals(prefix)
+
+    for signal in signals:
+        t, node, value = load_column(prefix, signal)
+        if len(t) == 0:
+            print(f"{signal:25} : (kayıt yok)")
+            continue
+        print(f"{signal:25} : {len(t)} kayıt, t=[{t[0]:.3f}, {t[-1]:.3f}] s, "
+              f"ortalama={value.mean():.4f}, max={value.max():.4f}, node sayısı={len(np.unique(node))}")
+
+        if csv_out:
+            out = np.column_stack([t, node, value])
+            with open(csv_out, "a") as f:
+                np.savetxt(f, out, delimiter=",", fmt=["%.9f", "%d", "%.9g"], header=signal, comments="# ")
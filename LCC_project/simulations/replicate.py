@@ -0,0 +1,118 @@
+import argparse
+import concurrent.futures
+import os
+import shutil
+import tempfile
+
+from calculate_conf import (load_runs, compute_run_metrics, confidence_interval, metrics_map,
+                            add_run_arguments, run_simulation)
+
+# Sabit "repeat = 10" yerine, seçilen metriklerin Student-t güven aralığı
+# yarı genişliği hedefin altına inene kadar yeni tekrar başlatır (sequential
+# stopping). Tüm çekirdekler dolu tutulur; karar sadece tamamlanmış ardışık
+# run'lar (0..k) üzerinden verilir, böylece kısa süren run'lar öne çıkmaz.
+#
+# Kullanım: python3 replicate.py -c Phy_Harsh [--rel-width 0.05] [--max-reps 50]
+
+parser = argparse.ArgumentParser(description="LCC sequential-stopping replication controller")
+parser.add_argument("-c", "--config", required=True, help="omnetpp.ini config adı")
+add_run_arguments(parser)
+parser.add_argument("--metrics", default="Global_PDR,Avg_Delay,Total_Throughput,Total_Overhead,Avg_Stability",
+                    help="durdurma kuralına giren metrikler (calculate_conf.py anahtarları)")
+parser.add_argument("--rel-width", type=float, default=0.05, help="hedef yarı genişlik / ortalama")
+parser.add_argument("--level", type=float, default=0.95, help="güven seviyesi")
+parser.add_argument("--min-reps", type=int, default=3, help="karar öncesi en az tekrar")
+parser.add_argument("--max-reps", type=int, default=50, help="en fazla tekrar")
+parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="paralel run sayısı")
+parser.add_argument("--out", default=None, help="birleşik sonuç dosyası (varsayılan: <config>_results.csv)")
+
+
+def run_once(args, workdir, rep):
+    prefix = os.path.join(workdir, f"run{rep}")
+    run_simulation(args.exe, args.ned_path, args.config, rep, prefix, [f"--repeat={args.max_reps}"])
+
+    _, chunks = load_runs(prefix + "_results.csv")
+    return prefix + "_results.csv", compute_run_metrics(chunks[-1])
+
+
+def converged(args, metrics, samples):
+    # Tüm metriklerde h <= rel_width * |ortalama| olmalı. Ortalaması 0 olan
+    # metrikte (örn. hiç drop yok) göreli genişlik tanımsız: karara girmez
+    for key in metrics:
+        mean_val, h = confidence_interval([s[key] for s in samples], args.level)
+        if h is None:
+            return False
+        if mean_val == 0:
+            continue
+        if h > args.rel_width * abs(mean_val):
+            return False
+    return True
+
+
+def report(metrics, samples, level):
+    print("\n" + "=" * 60)
+    print(f" SONUÇ RAPORU: {len(samples)} tekrar")
+    print("=" * 60)
+    for key in metrics:
+        mean_val, h = confidence_interval([s[key] for s in samples], level)
+        rel = f"(%{h / abs(mean_val) * 100:.1f})" if h is not None and mean_val != 0 else "(göreli genişlik yok)"
+        ci = f"± {h:.4f} {rel}" if h is not None else "(Tek Run)"
+        print(f"{metrics_map[key]:25} : {mean_val:.4f} {ci}")
+    print("=" * 60)
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    metrics = args.metrics.split(",")
+    for key in metrics:
+        if key not in metrics_map:
+            raise SystemExit(f"Bilinmeyen metrik: {key} ({', '.join(metrics_map)})")
+
+    results = {}          # rep -> (csv yolu, metrikler)
+    with tempfile.TemporaryDirectory(prefix="lcc_rep_") as workdir, \
+            concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+
+        print(f"Senaryo: {args.config}, hedef ±%{args.rel_width * 100:.1f} ({args.level * 100:.0f}% CI), "
+              f"{args.jobs} paralel run, en fazla {args.max_reps}")
+
+        next_rep = 0
+        pending = {}
+        done = False
+        while not done:
+            # Havuzu dolu tut
+            while len(pending) < args.jobs and next_rep < args.max_reps:
+                pending[pool.submit(run_once, args, workdir, next_rep)] = next_rep
+                next_rep += 1
+            if not pending:
+                break
+
+            finished, _ = concurrent.futures.wait(pending, return_when=concurrent.futures.FIRST_COMPLETED)
+            for f in finished:
+                results[pending.pop(f)] = f.result()
+
+            # Ardışık tamamlanmış run'lar (0..k) üzerinden karar ver
+            prefix_len = 0
+            while prefix_len in results:
+                prefix_len += 1
+            samples = [results[r][1] for r in range(prefix_len)]
+            if prefix_len >= args.min_reps:
+                print(f"  {prefix_len:3d} tekrar tamamlandı")
+                done = converged(args, metrics, samples)
+
+        # Hedefe ulaşıldı: başlamamış run'ları iptal et, çalışanların bitmesini bekle
+        for f in pending:
+            f.cancel()
+
+        if not done:
+            print(f"Uyarı: {args.max_reps} tekrarda hedef genişliğe ulaşılamadı.")
+        report(metrics, samples, args.level)
+
+        # Kullanılan run'ları calculate_conf.py'nin okuyabileceği tek dosyada birleştir
+        out_path = args.out or f"{args.config}_results.csv"
+        with open(out_path, "w") as out:
+            for r in range(len(samples)):
+                with open(results[r][0]) as f:
+                    shutil.copyfileobj(f, out)
+        print(f"Birleşik sonuçlar: {out_path}")
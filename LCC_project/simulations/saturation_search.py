@@ -0,0 +1,108 @@
+import argparse
+import concurrent.futures
+import math
+import os
+import tempfile
+import numpy as np
+
+from calculate_conf import load_runs, compute_run_metrics, confidence_interval, add_run_arguments, run_simulation
+
+# Bir senaryo (Nodes_60, Phy_Harsh, ...) için sürdürülebilir en yüksek yükü bulur.
+# LCC trafik üreteci CBR modunda sabit payload ile sürülür; teslim edilen
+# throughput (LCC::finish) önerilen yükü izlemeyi bıraktığı nokta "knee" kabul
+# edilir ve sendInterval üzerinde log-ölçekli ikili arama (bisection) yapılır.
+#
+# Kullanım: python3 saturation_search.py -c Nodes_60 [--reps 5] [--sim-time 30s]
+
+parser = argparse.ArgumentParser(description="LCC saturation throughput search")
+parser.add_argument("-c", "--config", required=True, help="omnetpp.ini config adı")
+add_run_arguments(parser)
+parser.add_argument("--reps", type=int, default=5, help="her yük noktası için tekrar sayısı")
+parser.add_argument("--sim-time", default="30s", help="kısa run süresi")
+parser.add_argument("--payload", type=int, default=512, help="payload (byte)")
+parser.add_argument("--min-interval", type=float, default=0.01, help="en ağır yük (s)")
+parser.add_argument("--max-interval", type=float, default=4.0, help="en hafif yük (s)")
+parser.add_argument("--knee", type=float, default=0.8,
+                    help="verim (teslim/önerilen) hafif yükteki değerin bu oranının altına inerse doymuş sayılır")
+parser.add_argument("--iterations", type=int, default=8, help="bisection adım sayısı")
+parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="paralel run sayısı")
+
+
+def run_once(args, workdir, interval, rep):
+    prefix = os.path.join(workdir, f"{args.config}_{interval:.6f}_{rep}")
+    run_simulation(args.exe, args.ned_path, args.config, rep, prefix,
+                   [f"--repeat={args.reps}",
+                    f"--sim-time-limit={args.sim_time}",
+                    '--**.app[0].trafficModel="cbr"',
+                    f"--**.app[0].sendInterval={interval}s",
+                    f"--**.app[0].payloadSize={args.payload}B"])
+
+    node_count, chunks = load_runs(prefix + "_results.csv")
+    metrics = compute_run_metrics(chunks[-1])
+    offered = node_count * args.payload * 8.0 / interval
+    return offered, metrics["Total_Throughput"]
+
+
+def run_point(args, pool, workdir, interval):
+    futures = [pool.submit(run_once, args, workdir, interval, rep) for rep in range(args.reps)]
+    samples = [f.result() for f in futures]
+    offered = samples[0][0]
+    delivered = [d for _, d in samples]
+    efficiency = [d / offered for d in delivered]
+    return offered, delivered, efficiency
+
+
+def report(label, interval, offered, delivered):
+    mean_val, h = confidence_interval(delivered)
+    ci = f"± {h:.1f}" if h is not None else "(Tek Run)"
+    print(f"{label:12} interval={interval:9.4f}s  önerilen={offered:12.1f} bps  teslim={mean_val:12.1f} {ci} bps")
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+    os.chdir(os.path.dirname(os.path.abspath(__file__)))
+
+    with tempfile.TemporaryDirectory(prefix="lcc_sat_") as workdir, \
+            concurrent.futures.ThreadPoolExecutor(max_workers=args.jobs) as pool:
+
+        print(f"Senaryo: {args.config}, {args.reps} tekrar/nokta, {args.jobs} paralel run")
+
+        # 1. Hafif yük: referans verim (PDR < %100 olsa bile doğrusal bölge)
+        offered, delivered, eff = run_point(args, pool, workdir, args.max_interval)
+        reference = np.mean(eff)
+        report("referans", args.max_interval, offered, delivered)
+        threshold = args.knee * reference
+
+        # 2. En ağır yük hâlâ izliyorsa arama aralığı yetersiz
+        offered, delivered, eff = run_point(args, pool, workdir, args.min_interval)
+        report("max yük", args.min_interval, offered, delivered)
+        if np.mean(eff) >= threshold:
+            print("Doyma noktası arama aralığının ötesinde: --min-interval küçültülmeli.")
+            raise SystemExit(0)
+
+        # 3. Log-ölçekli bisection: hi izliyor, lo doymuş
+        lo, hi = args.min_interval, args.max_interval
+        best = None
+        for _ in range(args.iterations):
+            mid = math.sqrt(lo * hi)
+            offered, delivered, eff = run_point(args, pool, workdir, mid)
+            tracking = np.mean(eff) >= threshold
+            report("izliyor" if tracking else "doymuş", mid, offered, delivered)
+            if tracking:
+                hi, best = mid, (mid, offered, delivered)
+            else:
+                lo = mid
+
+        print("\n" + "=" * 60)
+        print(f" DOYMA NOKTASI: {args.config}")
+        print("=" * 60)
+        if best is None:
+            print("Referans dışında izleyen nokta bulunamadı (knee çok yüksek yükte değil).")
+        else:
+            interval, offered, delivered = best
+            mean_val, h = confidence_interval(delivered)
+            ci = f"± {h:.1f}" if h is not None else "(Tek Run)"
+            print(f"{'sendInterval':25} : {interval:.4f} s")
+            print(f"{'Önerilen Yük':25} : {offered:.1f} bps")
+            print(f"{'Doyma Throughput':25} : {mean_val:.1f} {ci} bps")
+        print("=" * 60)
@@ -1,6 +1,10 @@
 #include "LCC.h"
 #include "inet/common/packet/Packet.h"
 #include "inet/networklayer/common/L3AddressResolver.h"
+#include "inet/common/ModuleAccess.h"
+#include "inet/physicallayer/wireless/common/contract/packetlevel/SignalTag_m.h"
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <cstring>
 #include <fstream>
@@ -14,12 +18,26 @@ LCC::LCC() {
     beaconTimer = nullptr;
     checkTimeoutTimer = nullptr;
     dataTimer = nullptr;
+    replayTimer = nullptr;
+    txTimer = nullptr;
+    snapshotTimer = nullptr;
+    warmupTimer = nullptr;
+    reportTimer = nullptr;
+    holdTimer = nullptr;
+    stopTimer = nullptr;
 }
 
 LCC::~LCC() {
     cancelAndDelete(beaconTimer);
     cancelAndDelete(checkTimeoutTimer);
     cancelAndDelete(dataTimer);
+    cancelAndDelete(replayTimer);
+    cancelAndDelete(txTimer);
+    cancelAndDelete(snapshotTimer);
+    cancelAndDelete(warmupTimer);
+    cancelAndDelete(reportTimer);
+    cancelAndDelete(holdTimer);
+    cancelAndDelete(stopTimer);
 }
 
 void LCC::initialize(int stage)
@@ -28,12 +46,74 @@ void LCC::initialize(int stage)
 
     if (stage == INITSTAGE_LOCAL) {
         beaconInterval = par("beaconInterval");
+        beaconJitter = par("beaconJitter");
         neighborValidityInterval = par("neighborValidityInterval");
         localPort = par("localPort");
         destPort = par("destPort");
         useMulticast = par("useMulticast");
         numHosts = par("numHosts");
 
+        std::string addressPlan = par("addressPlan").stdstringValue();
+        if (addressPlan == "arithmetic") arithmeticAddressPlan = true;
+        else if (addressPlan != "resolve")
+            throw cRuntimeError("Unknown addressPlan '%s' (resolve, arithmetic)", addressPlan.c_str());
+        addressBase = Ipv4Address(par("addressBase").stringValue());
+        multicastAddr = Ipv4Address("224.0.0.1");
+        hostAddresses.assign(numHosts, L3Address());
+
+        // Node tabloları: id ile indekslenen diziler (kapasite = numHosts)
+        neighborsLastSeen.reset(numHosts);
+        neighborsRoles.reset(numHosts);
+        neighborBeaconDigest.reset(numHosts);
+        foreignNeighbors.reset(numHosts);
+        myMembers.reset(numHosts);
+        clusterRoutingTable.reset(numHosts);
+        linkExpiry.reset(numHosts);
+        linkQuality.reset(numHosts);
+        pendingReports.reset(numHosts);
+        clusterDigest.reset(numHosts);
+        mySubtree.reset(numHosts);
+        neighborAdverts.reset(numHosts);
+        backboneGateways.reset(numHosts);
+        useBackbone = par("useBackbone");
+        useChHandover = par("useChHandover");
+        stopOperationExtraTime = par("stopOperationExtraTime");
+        stopOperationTimeout = par("stopOperationTimeout");
+
+        restartSolicitWindow = par("restartSolicitWindow");
+
+        clusterHops = par("clusterHops");
+        if (clusterHops < 1)
+            throw cRuntimeError("clusterHops must be at least 1 (got %d)", clusterHops);
+        maxHopRecords = par("maxHopRecords");
+        hopLimit = par("hopLimit");
+        resultFilePrefix = par("resultFilePrefix").stdstringValue();
+        logLevel = par("logLevel");
+        // Havuz process geneli: sayaçlar run başına bir kez (node 0) sıfırlanır
+        if (getParentModule()->getIndex() == 0)
+            LccChunkPool::beginRun();
+        LccChunkPool::setEnabled(par("useChunkPool"));
+
+        useMobilityPrediction = par("useMobilityPrediction");
+        linkRange = par("linkRange");
+        minLinkLifetime = par("minLinkLifetime").doubleValue();
+        handoverMargin = par("handoverMargin").doubleValue();
+        if (useMobilityPrediction)
+            mobility = check_and_cast<IMobility *>(getContainingNode(this)->getSubmodule("mobility"));
+
+        useLinkQuality = par("useLinkQuality");
+        linkQualityAlpha = par("linkQualityAlpha");
+        snirGoodThreshold = par("snirGoodThreshold");
+        snirBadThreshold = par("snirBadThreshold");
+        if (snirBadThreshold > snirGoodThreshold)
+            throw cRuntimeError("snirBadThreshold (%g dB) must not exceed snirGoodThreshold (%g dB)", snirBadThreshold, snirGoodThreshold);
+
+        std::string traceMode = par("traceMode").stdstringValue();
+        if (traceMode == "record") traceRecording = true;
+        else if (traceMode == "replay") traceReplaying = true;
+        else if (traceMode != "none")
+            throw cRuntimeError("Unknown traceMode '%s' (none, record, replay)", traceMode.c_str());
+
         myId = getParentModule()->getIndex();
         myRole = 0;
         myClusterHeadId = -1;
@@ -48,10 +128,53 @@ void LCC::initialize(int stage)
         numBeaconsSent = 0;
         numRoleChanges = 0;
 
+        double sketchError = par("sketchRelativeError");
+        delaySketch = LccQuantileSketch(1e-6, 1e3, sketchError);
+        chLifetimeSketch = LccQuantileSketch(1e-3, 1e5, sketchError);
+        clusterSizeSketch = LccQuantileSketch(1, 1e4, sketchError);
+        holdWaitSketch = LccQuantileSketch(1e-6, 1e3, sketchError);
+
         // Timerlar
         beaconTimer = new cMessage("beaconTimer");
         checkTimeoutTimer = new cMessage("checkTimeoutTimer");
         dataTimer = new cMessage("dataTimer");
+        replayTimer = new cMessage("replayTimer");
+        txTimer = new cMessage("txTimer");
+        snapshotTimer = new cMessage("snapshotTimer");
+        warmupTimer = new cMessage("warmupTimer");
+        reportTimer = new cMessage("reportTimer");
+        holdTimer = new cMessage("holdTimer");
+        stopTimer = new cMessage("stopTimer");
+
+        // Transmit Scheduler: Control > Intra-cluster > Inter-cluster
+        txScheduler.configure(TX_CONTROL, par("txRateControl"), par("txBurst"));
+        txScheduler.configure(TX_INTRA, par("txRateIntra"), par("txBurst"));
+        txScheduler.configure(TX_INTER, par("txRateInter"), par("txBurst"));
+        txScheduler.setQueueLimit(par("txQueueLimit"));
+
+        // Store-and-Forward: rotası olmayan paketler için sınırlı bekleme
+        std::string holdDropPolicy = par("holdDropPolicy").stdstringValue();
+        int holdPolicy = HOLD_DROP_TAIL;
+        if (holdDropPolicy == "head") holdPolicy = HOLD_DROP_HEAD;
+        else if (holdDropPolicy != "tail")
+            throw cRuntimeError("Unknown holdDropPolicy '%s' (tail, head)", holdDropPolicy.c_str());
+        holdBuffer.configure(par("holdBufferSize"), holdPolicy);
+        holdTime = par("holdTime");
+
+        trafficGenerator.configure(this);
+
+        memberReportInterval = par("memberReportInterval").doubleValue();
+        aggregateReports = par("aggregateReports");
+
+        // Warm-start: kayıtlı cluster durumu ve konum INITSTAGE_LOCAL'da yüklenir
+        // (mobility initialX/Y'yi SINGLE_MOBILITY aşamasında okur)
+        snapshotMode = par("snapshotMode").stdstringValue();
+        snapshotFileName = par("snapshotFile").stdstringValue() + "-" + std::to_string(myId) + ".snap";
+        if (snapshotMode == "load")
+            loadSnapshot();
+        else if (snapshotMode != "none" && snapshotMode != "save")
+            throw cRuntimeError("Unknown snapshotMode '%s' (none, save, load)", snapshotMode.c_str());
+        warmupPeriod = getSimulation()->getWarmupPeriod();
 
         // Sinyaller
         chChangeSignal = registerSignal("chChangeSignal");
@@ -62,41 +185,182 @@ void LCC::initialize(int stage)
         pdrSignal = registerSignal("pdrSignal");
         dataSentSignal = registerSignal("dataSentSignal");
         dataReceivedSignal = registerSignal("dataReceivedSignal");
+        hopCountSignal = registerSignal("hopCountSignal");
+        dataDroppedSignal = registerSignal("dataDroppedSignal");
+        txQueueLengthSignal = registerSignal("txQueueLengthSignal");
+        txQueueWaitSignal = registerSignal("txQueueWaitSignal");
+        beaconQueueWaitSignal = registerSignal("beaconQueueWaitSignal");
+        roleChangeSignal = registerSignal("roleChangeSignal");
+        chOutageSignal = registerSignal("chOutageSignal");
+        restartRecoverySignal = registerSignal("restartRecoverySignal");
+        holdBufferLengthSignal = registerSignal("holdBufferLengthSignal");
+        holdWaitSignal = registerSignal("holdWaitSignal");
     }
     else if (stage == INITSTAGE_APPLICATION_LAYER) {
-        socket.setOutputGate(gate("socketOut"));
-        socket.bind(localPort);
-        socket.setCallback(this);
+        // Socket ve timerlar handleStartOperation'da (ApplicationBase bu aşamada çağırır)
+
+        // Trace dosyası: node başına bir dosya (<traceFile>-<id>.bin)
+        std::string traceFileName = par("traceFile").stdstringValue() + "-" + std::to_string(myId) + ".bin";
+        if (traceRecording)
+            traceWriter.open(traceFileName);
+        else if (traceReplaying) {
+            traceReader.open(traceFileName);
+            if (traceReader.hasNext())
+                scheduleAt(traceReader.getNextArrivalTime(), replayTimer);
+        }
+    }
+}
 
-        // Discovery (Keşif) ve Beaconlar için Multicast dinlemeye devam
-        L3Address mcastAddr = L3AddressResolver().resolve("224.0.0.1");
-        socket.joinMulticastGroup(mcastAddr);
+// ------------------------------------------------------------------
+// LIFECYCLE (Başlama / Kapanma / Çökme)
+// ------------------------------------------------------------------
+// operation == nullptr: simülasyon başı. Aksi halde ScenarioManager ile
+// yeniden başlama; durum kapanışta temizlendiği için node sıfırdan kümelenir.
+void LCC::handleStartOperation(LifecycleOperation *operation) {
+    socket.setOutputGate(gate("socketOut"));
+    socket.bind(localPort);
+    socket.setCallback(this);
+
+    // Discovery (Keşif) ve Beaconlar için Multicast dinlemeye devam
+    socket.joinMulticastGroup(multicastAddr);
+
+    if (operation != nullptr) {
+        numRestarts++;
+        recovering = true;
+        restartTime = simTime();
+    }
 
+    // Yeniden başlama: solicit beacon'ı hemen, ilk LCC kararı komşular cevapladıktan sonra
+    if (operation != nullptr && restartSolicitWindow > SIMTIME_ZERO) {
+        solicitPending = true;
+        scheduleAt(simTime(), beaconTimer);
+        scheduleAt(simTime() + restartSolicitWindow, checkTimeoutTimer);
+    }
+    else {
         scheduleAt(simTime() + uniform(0, 2), beaconTimer);
         scheduleAt(simTime() + beaconInterval, checkTimeoutTimer);
-        scheduleAt(simTime() + uniform(1, 3), dataTimer);
-
-        updateVisuals();
     }
+    scheduleAt(simTime() + par("dataStartTime").doubleValue(), dataTimer);
+
+    // Tek seferlik timerlar: zamanı geçmişse (kapalıyken) tekrar kurulmaz
+    simtime_t snapshotTime = par("snapshotTime").doubleValue();
+    if (snapshotMode == "save" && snapshotTime >= simTime())
+        scheduleAt(snapshotTime, snapshotTimer);
+    if (warmupPeriod > simTime())
+        scheduleAt(warmupPeriod, warmupTimer);
+    if (memberReportInterval > SIMTIME_ZERO)
+        scheduleAt(simTime() + memberReportInterval + uniform(0, memberReportInterval), reportTimer);
+    if (operation != nullptr && traceReplaying && traceReader.hasNext())
+        scheduleAt(std::max(simTime(), traceReader.getNextArrivalTime()), replayTimer);
+
+    updateVisuals();
 }
 
-void LCC::handleStartOperation(LifecycleOperation *operation) {}
 void LCC::handleStopOperation(LifecycleOperation *operation) {
-    cancelEvent(beaconTimer);
-    cancelEvent(checkTimeoutTimer);
-    cancelEvent(dataTimer);
-    socket.close();
+    // CH kapanıyor: üyeler timeout beklemeden yedek CH'ye geçsin (kuyruk atlanır)
+    bool departing = useChHandover && myRole == 2;
+    if (departing) {
+        auto departure = makePooled<LccClusterCast>();
+        departure->setKind(CAST_DEPARTURE);
+        departure->setBackupChId(selectBackupCh());
+        clusterBroadcast(departure, true);
+    }
+
+    cancelTimers();
+    resetState();
+
+    // Alt katmanlar (UDP, IP, MAC, radyo) LCC bitirene kadar kapanmaz: ayrılış
+    // yayını havaya çıkana kadar (stopOperationExtraTime) operasyonu beklet
+    if (departing) {
+        delayActiveOperationFinish(stopOperationTimeout);
+        scheduleAt(simTime() + stopOperationExtraTime, stopTimer);
+    }
+    else
+        socket.close();
 }
+
 void LCC::handleCrashOperation(LifecycleOperation *operation) {
+    cancelTimers();
+    resetState();
     if (operation->getRootModule() != getContainingNode(this))
         socket.destroy();
 }
 
+void LCC::cancelTimers()
+{
+    cancelEvent(beaconTimer);
+    cancelEvent(checkTimeoutTimer);
+    cancelEvent(dataTimer);
+    cancelEvent(replayTimer);
+    cancelEvent(txTimer);
+    cancelEvent(snapshotTimer);
+    cancelEvent(warmupTimer);
+    cancelEvent(reportTimer);
+    cancelEvent(holdTimer);
+    cancelEvent(stopTimer);
+}
+
+// Kapanan node'un tüm kümelenme / routing durumu silinir. Tablolar clear() ile
+// boşaltılır (kapasite korunur, yeniden başlamada ayırma yok). seqNum korunur:
+// komşuların seenPackets'ı yeni paketleri duplicate saymasın.
+void LCC::resetState()
+{
+    if (myRole == 2) {
+        emit(chLifetimeSignal, simTime() - chStartTime);
+        chLifetimeSketch.add((simTime() - chStartTime).dbl());
+    }
+    if (myRole != 0) emit(chChangeSignal, 1);
+    myRole = 0;
+    myClusterHeadId = -1;
+    isGateway = false;
+    myParentId = -1;
+    myChHops = 0;
+    myBackupChId = -1;
+    inOutage = false;
+    solicitPending = false;
+    recovering = false;
+
+    neighborsLastSeen.clear();
+    neighborsRoles.clear();
+    neighborBeaconDigest.clear();
+    foreignNeighbors.clear();
+    myMembers.clear();
+    clusterRoutingTable.clear();
+    linkExpiry.clear();
+    linkQuality.clear();
+    pendingReports.clear();
+    clusterDigest.clear();
+    mySubtree.clear();
+    neighborAdverts.clear();
+    backboneGateways.clear();
+    seenPackets.clear();
+
+    // Kapanışta kuyrukta kalan paketler kaybolur: sessizce silinmesin, drop sayılsın
+    std::vector<LccHoldBuffer::Entry> held;
+    holdBuffer.takeAll(held);
+    for (auto const& entry : held) {
+        if (entry.enqueueTime < warmupPeriod) continue;   // warm-up paketi: sayaçlar sıfırlandı
+        numHoldExpired++;
+        countDrop(entry.dropReason);
+    }
+    if (!held.empty())
+        emit(holdBufferLengthSignal, 0);
+    if (!txScheduler.isEmpty()) {
+        numTxQueueDrops += txScheduler.getLength();
+        txScheduler.clear();
+        emit(txQueueLengthSignal, 0);
+    }
+}
+
 void LCC::handleMessageWhenUp(cMessage *msg)
 {
     if (msg == beaconTimer) {
         sendBeacon();
-        scheduleAt(simTime() + beaconInterval, beaconTimer);
+        // Jitter: komşuların beaconları senkronize olup çarpışmasın
+        simtime_t nextBeacon = beaconInterval;
+        if (beaconJitter > SIMTIME_ZERO)
+            nextBeacon += uniform(-beaconJitter, beaconJitter);
+        scheduleAt(simTime() + nextBeacon, beaconTimer);
     }
     else if (msg == checkTimeoutTimer) {
         checkTimeouts();
@@ -104,7 +368,35 @@ void LCC::handleMessageWhenUp(cMessage *msg)
     }
     else if (msg == dataTimer) {
         sendDataPacket();
-        scheduleAt(simTime() + uniform(2.0, 4.0), dataTimer);
+        scheduleAt(simTime() + trafficGenerator.nextInterval(simTime()), dataTimer);
+    }
+    else if (msg == replayTimer) {
+        replayNextArrival();
+    }
+    else if (msg == txTimer) {
+        serviceTxQueue();
+    }
+    else if (msg == snapshotTimer) {
+        saveSnapshot();
+    }
+    else if (msg == warmupTimer) {
+        resetStatistics();
+    }
+    else if (msg == stopTimer) {
+        socket.close();
+        finishActiveOperation();
+    }
+    else if (operationalState == STOPPING_OPERATION) {
+        // Kapanış bekleniyor: durum zaten silindi, gelen paketler işlenmez
+        delete msg;
+    }
+    else if (msg == holdTimer) {
+        expireHeldPackets();
+    }
+    else if (msg == reportTimer) {
+        if (myRole == 1) sendMemberReport();
+        else if (myRole == 2 && aggregateReports) flushReportDigest();
+        scheduleAt(simTime() + memberReportInterval, reportTimer);
     }
     else {
         socket.processMessage(msg);
@@ -117,12 +409,28 @@ void LCC::handleMessageWhenUp(cMessage *msg)
 void LCC::sendBeacon()
 {
     Packet *packet = new Packet("LccBeacon");
-    auto beacon = makeShared<LccBeacon>();
+    auto beacon = makePooled<LccBeacon>();
 
     beacon->setSrcId(myId);
     beacon->setRole(static_cast<LccRole>(myRole));
     beacon->setClusterHeadId(myClusterHeadId);
     beacon->setChunkLength(B(100));
+    if (solicitPending) {
+        beacon->setSolicit(true);
+        solicitPending = false;
+    }
+
+    // Konum + hız: komşular link ömrünü (LET) tahmin edebilsin
+    if (mobility) {
+        const Coord& pos = mobility->getCurrentPosition();
+        const Coord& vel = mobility->getCurrentVelocity();
+        beacon->setHasMobility(true);
+        beacon->setPosX(pos.x);
+        beacon->setPosY(pos.y);
+        beacon->setVelX(vel.x);
+        beacon->setVelY(vel.y);
+        beacon->setChunkLength(B(100 + 16));
+    }
 
     // Gateway Raporlaması: Gördüğüm yabancı kümeleri Liderime bildiriyorum
     if (isGateway && !foreignNeighbors.empty()) {
@@ -136,12 +444,39 @@ void LCC::sendBeacon()
         beacon->setSeenClusterIdsArraySize(0);
     }
 
+    // Yedek CH: CH kaybolursa üyeler yeniden seçim yapmadan buna geçer
+    if (useChHandover && myRole == 2) {
+        myBackupChId = selectBackupCh();
+        beacon->setBackupChId(myBackupChId);
+        beacon->setChunkLength(beacon->getChunkLength() + B(4));
+    }
+
+    // k-hop: ağaç bilgisi + alt ağaçtaki gateway'lerin gördüğü cluster'lar (CH'ye kadar taşınır)
+    if (clusterHops > 1) {
+        beacon->setChHops(myChHops);
+        beacon->setParentId(myParentId);
+        beacon->setSubtreeIdsArraySize(mySubtree.size());
+        int i = 0;
+        for (int id : mySubtree)
+            beacon->setSubtreeIds(i++, id);
+
+        for (auto const& [neighborId, advert] : neighborAdverts) {
+            if (!isChild(advert)) continue;
+            for (int clusterId : advert.seenClusters) {
+                bool alreadyIn = clusterId == myClusterHeadId;
+                for (size_t k = 0; k < beacon->getSeenClusterIdsArraySize() && !alreadyIn; k++)
+                    alreadyIn = beacon->getSeenClusterIds(k) == clusterId;
+                if (!alreadyIn) beacon->appendSeenClusterIds(clusterId);
+            }
+        }
+        beacon->setChunkLength(beacon->getChunkLength() + B(8 + 4 * mySubtree.size()));
+    }
+
     packet->insertAtBack(beacon);
     emit(controlOverheadSignal, 1);
     numBeaconsSent++;
     // Beaconlar her zaman Multicast (Herkes duysun)
-    L3Address destAddr = L3AddressResolver().resolve("224.0.0.1");
-    socket.sendTo(packet, destAddr, destPort);
+    sendPacket(packet, multicastAddr, TX_CONTROL);
 }
 
 // ------------------------------------------------------------------
@@ -152,51 +487,71 @@ void LCC::sendDataPacket()
     // Komşum yoksa paket atma
     if (myRole == 0 && neighborsLastSeen.empty()) return;
 
-    Packet *packet = new Packet("LccData");
-    auto data = makeShared<LccData>();
+    auto data = makePooled<LccData>();
 
     data->setSrcId(myId);
     data->setSendTime(simTime());
-    data->setChunkLength(B(1024));
+    data->setHopLimit(hopLimit);
+    data->setChunkLength(B(trafficGenerator.nextPayloadSize()));
 
     // Paket Kimliği
     data->setSeqNo(seqNum++);
     std::string pktId = std::to_string(myId) + ":" + std::to_string(data->getSeqNo());
     seenPackets[pktId] = simTime();
 
-    L3Address destAddr;
-
     if (useMulticast) {
         // Phase 3 Test Modu
-        if (neighborsLastSeen.empty()) { delete packet; return; }
+        if (neighborsLastSeen.empty()) { countDrop(DROP_NO_ROUTE); return; }
         auto it = neighborsLastSeen.begin();
         std::advance(it, intuniform(0, neighborsLastSeen.size() - 1));
         data->setDestId(it->first);
-        destAddr = L3AddressResolver().resolve("224.0.0.1");
     }
     else {
         // Phase 4: Unicast / Hierarchical Routing
-        int randomNodeIndex = intuniform(0, numHosts - 1);
-        while (randomNodeIndex == myId) randomNodeIndex = intuniform(0, numHosts - 1);
-        data->setDestId(randomNodeIndex);
+        data->setDestId(trafficGenerator.pickDestination(myId, numHosts));
+    }
+
+    int reason = dispatchOwnData(data);
+    if (reason != ROUTE_SENT)
+        holdOrDrop(reason, "LccData", data, true);
+}
 
+// Kendi paketimi ilk hop'a verir (sendDataPacket ve hold buffer flush'ı).
+// CH'ye bağlı olmayan Member için DROP_NO_CH, aksi halde ROUTE_SENT döner.
+int LCC::dispatchOwnData(const Ptr<LccData>& data)
+{
+    L3Address destAddr = multicastAddr;
+    const char *packetName = "LccData";
+    int firstHopKind = HOP_DIRECT;
+    int txClass = TX_INTRA;
+
+    if (!useMulticast) {
         if (myRole == 1) {
-            if (myClusterHeadId != -1) {
-                std::string chName = "host[" + std::to_string(myClusterHeadId) + "]";
-                destAddr = L3AddressResolver().resolve(chName.c_str());
-                EV << "DATA START: Member -> CH (" << myClusterHeadId << ")" << endl;
-            } else { delete packet; return; }
+            if (upstreamHop() == -1) return DROP_NO_CH;
+            destAddr = hostAddress(upstreamHop());
+            LCC_EV(LCC_LOG_PACKET) << "DATA START: Member -> CH (" << myClusterHeadId << ")" << endl;
+            firstHopKind = HOP_MEMBER_TO_CH;
         }
         else {
-            destAddr = L3AddressResolver().resolve("224.0.0.1");
-            packet->setName("InterClusterData");
-            EV << "DATA START: CH -> Flood Start." << endl;
+            packetName = "InterClusterData";
+            LCC_EV(LCC_LOG_PACKET) << "DATA START: CH -> Flood Start." << endl;
+            firstHopKind = HOP_CH_TO_GATEWAY;
+            txClass = TX_INTER;
         }
     }
-    numSent++;
-    emit(dataSentSignal, 1);
+    if (maxHopRecords > 0) {
+        data->setTraceHops(true);
+        appendHop(data, firstHopKind);
+    }
+    // Warm-up içinde üretilip hold buffer'da bekleyen paket: alıcıda da sayılmaz
+    if (data->getSendTime() >= warmupPeriod) {
+        numSent++;
+        emit(dataSentSignal, 1);
+    }
+    Packet *packet = new Packet(packetName);
     packet->insertAtBack(data);
-    socket.sendTo(packet, destAddr, destPort);
+    sendPacket(packet, destAddr, txClass);
+    return ROUTE_SENT;
 }
 
 // ------------------------------------------------------------------
@@ -204,22 +559,98 @@ void LCC::sendDataPacket()
 // ------------------------------------------------------------------
 void LCC::socketDataArrived(UdpSocket *socket, Packet *packet)
 {
-    auto chunk = packet->peekAtFront<Chunk>();
-
-    // 1. DATA PAKETİ (Veri Geldi)
-    if (auto dataPkt = dynamicPtrCast<const LccData>(chunk)) {
-        processDataPacket(packet, dataPkt);
-        delete packet;
-        return;
+    // Tip etiketi: tek peek + switch (her paket için dynamicPtrCast zinciri yerine)
+    auto header = packet->peekAtFront<LccChunk>();
+
+    switch (header->getLccType()) {
+        case LCC_CLUSTER_CAST: {
+            // CLUSTER KAPSAMLI YAYIN: başka cluster'ın yayını hiçbir tabloya
+            // (seenPackets, komşu tabloları) dokunmadan burada atılır. Trace'e
+            // filtreden önce yazılır: replay'de discard sayacı da aynı çıkar
+            auto cast = staticPtrCast<const LccClusterCast>(header);
+            if (traceRecording)
+                traceWriter.writeClusterCast(simTime(), packet, *cast);
+            if (cast->getSrcId() != myId) {
+                if (cast->getClusterId() == myClusterHeadId) processClusterCast(cast);
+                else numClusterCastDiscarded++;
+            }
+            break;
+        }
+        case LCC_REPORT: {
+            auto report = staticPtrCast<const LccReport>(header);
+            if (traceRecording)
+                traceWriter.writeReport(simTime(), packet, *report);
+            if (myRole == 2 && report->getClusterId() == myId) processMemberReport(report);
+            break;
+        }
+        case LCC_DATA: {
+            // DATA PAKETİ (Veri Geldi)
+            auto dataPkt = staticPtrCast<const LccData>(header);
+            if (traceRecording)
+                traceWriter.writeData(simTime(), packet, *dataPkt);
+            processDataPacket(packet, dataPkt);
+            break;
+        }
+        case LCC_BEACON: {
+            // BEACON PAKETİ (Sinyal Geldi)
+            auto beacon = staticPtrCast<const LccBeacon>(header);
+            if (traceRecording)
+                traceWriter.writeBeacon(simTime(), packet, *beacon);
+            processBeacon(packet, beacon);
+            break;
+        }
+        default:
+            break;
     }
+    delete packet;
+}
 
-    // 2. BEACON PAKETİ (Sinyal Geldi)
-    if (auto beacon = dynamicPtrCast<const LccBeacon>(chunk)) {
+uint64_t LCC::beaconDigest(const LccBeacon& beacon) const
+{
+    // FNV-1a: beacon içeriği + işlenişini belirleyen kendi durumum
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&h](int v) { h = (h ^ (uint32_t)v) * 1099511628211ULL; };
+    mix(myRole);
+    mix(myClusterHeadId);
+    mix(beacon.getRole());
+    mix(beacon.getClusterHeadId());
+    for (size_t k = 0; k < beacon.getSeenClusterIdsArraySize(); k++)
+        mix(beacon.getSeenClusterIds(k));
+    mix(beacon.getBackupChId());
+    mix(beacon.getChHops());
+    mix(beacon.getParentId());
+    for (size_t k = 0; k < beacon.getSubtreeIdsArraySize(); k++)
+        mix(beacon.getSubtreeIds(k));
+    return h;
+}
 
-        int senderId = beacon->getSrcId();
+void LCC::processBeacon(Packet *packet, const Ptr<const LccBeacon>& beacon)
+{
+    int senderId = beacon->getSrcId();
+
+    // Kendi beacon'ımı görmezden gel
+    if (senderId == myId) return;
+
+    // Yeniden başlayan komşu: bir sonraki beacon'ımı solicit penceresinin ilk
+    // yarısına çek (rastgele: cevaplar birbiriyle çarpışmasın)
+    if (beacon->getSolicit() && restartSolicitWindow > SIMTIME_ZERO) {
+        simtime_t reply = simTime() + uniform(0, restartSolicitWindow / 2);
+        if (beaconTimer->isScheduled() && beaconTimer->getArrivalTime() > reply) {
+            cancelEvent(beaconTimer);
+            scheduleAt(reply, beaconTimer);
+        }
+    }
 
-        // Kendi beacon'ımı görmezden gel
-        if (senderId == myId) { delete packet; return; }
+    // HIZLI YOL: bilinen komşu, aynı içerik ve benim rol/CH'm değişmemiş ->
+    // A/B adımları aynı yazmaları yapacaktı, sadece zaman damgası yenilenir
+    uint64_t digest = beaconDigest(*beacon);
+    auto lastSeenIt = neighborsLastSeen.find(senderId);
+    auto digestIt = neighborBeaconDigest.find(senderId);
+    if (lastSeenIt != neighborsLastSeen.end() && digestIt != neighborBeaconDigest.end() && digestIt->second == digest) {
+        lastSeenIt->second = simTime().raw();
+    }
+    else {
+        bool wasGateway = isGateway;
 
         // A) Gateway Tespiti (Yabancı bir cluster üyesini duydum mu?)
         if (beacon->getClusterHeadId() != myClusterHeadId && beacon->getClusterHeadId() != -1) {
@@ -233,13 +664,7 @@ void LCC::socketDataArrived(UdpSocket *socket, Packet *packet)
             // Gelen beacon BENİM ÜYEMDEN mi?
             if (beacon->getClusterHeadId() == myId) {
 
-                bool isMemberRecorded = false;
-                for (int m : myMembers) {
-                    if (m == senderId) { isMemberRecorded = true; break; }
-                }
-                if (!isMemberRecorded) {
-                    myMembers.push_back(senderId);
-                }
+                myMembers.insert(senderId);
                 // ---------------------------------------------------------
 
                 // Routing Tablosunu Güncelle (Üyem başka cluster görüyor mu?)
@@ -253,17 +678,366 @@ void LCC::socketDataArrived(UdpSocket *socket, Packet *packet)
 
                     if (!alreadyIn) gateways.push_back(senderId);
                 }
+
+                // Backbone: üyenin artık görmediği cluster'lardan çıkar, seçimi tazele
+                if (useBackbone) {
+                    pruneGateway(senderId, beacon.get());
+                    updateBackbone();
+                }
             }
         }
 
-        neighborsLastSeen[senderId] = simTime();
+        neighborsLastSeen[senderId] = simTime().raw();
         neighborsRoles[senderId] = beacon->getRole();
+        neighborBeaconDigest[senderId] = digest;
+
+        // k-hop: komşunun CH duyurusu ve ağaç bilgisi (runKHopLogic / aşağı yönlendirme)
+        if (clusterHops > 1) {
+            KHopAdvert& advert = neighborAdverts[senderId];
+            advert.clusterHeadId = beacon->getClusterHeadId();
+            advert.chHops = beacon->getChHops();
+            advert.parentId = beacon->getParentId();
+            advert.subtree.resize(beacon->getSubtreeIdsArraySize());
+            for (size_t k = 0; k < advert.subtree.size(); k++)
+                advert.subtree[k] = beacon->getSubtreeIds(k);
+            advert.seenClusters.resize(beacon->getSeenClusterIdsArraySize());
+            for (size_t k = 0; k < advert.seenClusters.size(); k++)
+                advert.seenClusters[k] = beacon->getSeenClusterIds(k);
+        }
+
+        // Görsel sadece durum değişince güncellenir
+        if (isGateway != wasGateway)
+            updateVisuals();
+
+        // Yeni komşu / gateway / rota olabilir: bekleyen paketleri tekrar dene
+        flushHoldBuffer();
+    }
+
+    // CH'min duyurduğu yedek (rol/CH değişince hızlı yol zaten atlanır)
+    if (useChHandover && myRole == 1 && senderId == myClusterHeadId)
+        myBackupChId = beacon->getBackupChId();
+
+    // C) LINK EXPIRATION TIME (Su & Gerla): göreli konum/hızdan kopma anı
+    if (mobility && beacon->getHasMobility()) {
+        const Coord& pos = mobility->getCurrentPosition();
+        const Coord& vel = mobility->getCurrentVelocity();
+        double a = vel.x - beacon->getVelX(), b = pos.x - beacon->getPosX();
+        double c = vel.y - beacon->getVelY(), d = pos.y - beacon->getPosY();
+        double relSpeed2 = a * a + c * c;
+
+        simtime_t expiry = SIMTIME_MAX;   // göreli hız yok: link sabit
+        if (relSpeed2 > 0) {
+            double disc = relSpeed2 * linkRange * linkRange - (a * d - b * c) * (a * d - b * c);
+            double let = (disc < 0) ? 0 : (-(a * b + c * d) + std::sqrt(disc)) / relSpeed2;
+            expiry = simTime() + std::max(0.0, let);
+        }
+        linkExpiry[senderId] = expiry;
+    }
+
+    // D) LINK KALİTESİ: radyonun eklediği SNIR göstergesi (replay'de trace'ten gelir)
+    if (useLinkQuality) {
+        if (auto snirInd = packet->findTag<SnirInd>())
+            updateLinkQuality(senderId, 10 * std::log10(snirInd->getMinimumSnir()));
+    }
+}
+
+// ------------------------------------------------------------------
+// CLUSTER KAPSAMLI YAYIN & ÜYE RAPORLARI
+// ------------------------------------------------------------------
+void LCC::clusterBroadcast(const Ptr<LccClusterCast>& cast, bool immediate)
+{
+    // Tek multicast: N üyeye N unicast yerine; yabancı node'lar clusterId ile erken atar
+    cast->setSrcId(myId);
+    cast->setClusterId(myId);
+    cast->setSeqNo(clusterCastSeq++);
+    cast->setChunkLength(B(16 + 8 * cast->getMemberIdsArraySize()));
+
+    Packet *packet = new Packet("LccClusterCast");
+    packet->insertAtBack(cast);
+    numClusterCastsSent++;
+    if (immediate) transmit(packet, multicastAddr);   // kapanışta: tx kuyruğu boşaltılıyor
+    else sendPacket(packet, multicastAddr, TX_INTRA);
+}
+
+void LCC::sendMemberReport()
+{
+    if (myClusterHeadId == -1) return;
+
+    auto report = makePooled<LccReport>();
+    report->setSrcId(myId);
+    report->setClusterId(myClusterHeadId);
+    report->setNeighborCount(neighborsLastSeen.size());
+    report->setChunkLength(B(16));
+
+    Packet *packet = new Packet("LccReport");
+    packet->insertAtBack(report);
+    sendPacket(packet, hostAddress(myClusterHeadId), TX_CONTROL);
+}
+
+void LCC::processMemberReport(const Ptr<const LccReport>& report)
+{
+    pendingReports[report->getSrcId()] = report->getNeighborCount();
+
+    // Toplama kapalıysa her rapor ayrı bir yayınla üyelere iletilir
+    if (!aggregateReports)
+        flushReportDigest();
+}
 
+void LCC::flushReportDigest()
+{
+    if (pendingReports.empty()) return;
+
+    auto digest = makePooled<LccClusterCast>();
+    digest->setKind(CAST_REPORT_DIGEST);
+    digest->setMemberIdsArraySize(pendingReports.size());
+    digest->setMemberValuesArraySize(pendingReports.size());
+    int i = 0;
+    for (auto const& [memberId, neighborCount] : pendingReports) {
+        digest->setMemberIds(i, memberId);
+        digest->setMemberValues(i, neighborCount);
+        i++;
+    }
+    pendingReports.clear();
+    clusterBroadcast(digest);
+}
+
+void LCC::processClusterCast(const Ptr<const LccClusterCast>& cast)
+{
+    if (cast->getKind() == CAST_REPORT_DIGEST) {
+        for (size_t k = 0; k < cast->getMemberIdsArraySize(); k++)
+            clusterDigest[cast->getMemberIds(k)] = cast->getMemberValues(k);
+    }
+    else if (cast->getKind() == CAST_DEPARTURE && myRole == 1 && cast->getSrcId() == myClusterHeadId) {
+        // CH kapandı: komşu tablolarından hemen düşür, yedeğe geç (yoksa yeniden seçim)
+        LCC_EV(LCC_LOG_INFO) << "DEPARTURE: CH " << myClusterHeadId << " kapaniyor, yedek " << cast->getBackupChId() << endl;
+        forgetNeighbor(cast->getSrcId());
+        beginOutage(simTime());
+        myBackupChId = cast->getBackupChId();
+        if (!handoverToBackup()) {
+            emit(chChangeSignal, 1);
+            myRole = 0;
+            myClusterHeadId = -1;
+            if (clusterHops > 1) runKHopLogic();
+            else runLCCLogic();
+        }
+        noteAffiliation();
         updateVisuals();
+    }
+}
+
+// ------------------------------------------------------------------
+// GÖNDERME & TRACE REPLAY
+// ------------------------------------------------------------------
+const L3Address& LCC::hostAddress(int id)
+{
+    if (id < 0 || id >= numHosts)
+        throw cRuntimeError("LCC: host id %d out of range (numHosts = %d)", id, numHosts);
+
+    // Her paket için modül ağacında arama yapmak yerine adres bir kez çözülür.
+    // arithmetic planında diğer host modüllerine hiç dokunulmaz (parsim'de
+    // başka partition'daki modüller bu process'te yoktur)
+    L3Address& addr = hostAddresses[id];
+    if (addr.isUnspecified()) {
+        if (arithmeticAddressPlan)
+            addr = Ipv4Address(addressBase.getInt() + id);
+        else
+            addr = L3AddressResolver().resolve(("host[" + std::to_string(id) + "]").c_str());
+    }
+    return addr;
+}
+
+void LCC::sendPacket(Packet *packet, const L3Address& destAddr, int txClass)
+{
+    if (!txScheduler.enqueue(txClass, packet, destAddr, simTime())) {
+        LCC_EV(LCC_LOG_PACKET) << "DROP: Tx kuyrugu dolu (sinif " << txClass << ")" << endl;
+        numTxQueueDrops++;
         delete packet;
         return;
     }
-    delete packet;
+    serviceTxQueue();
+}
+
+void LCC::serviceTxQueue()
+{
+    // Token'ı olan paketleri öncelik sırasıyla gönder
+    LccTxScheduler::Entry entry;
+    while (txScheduler.dequeue(simTime(), entry)) {
+        emit(txQueueWaitSignal, simTime() - entry.enqueueTime);
+        if (entry.txClass == TX_CONTROL) emit(beaconQueueWaitSignal, simTime() - entry.enqueueTime);
+        if (entry.txClass == TX_INTER) numInterClusterTx++;   // sadece gerçekten gönderilen
+        transmit(entry.packet, entry.destAddr);
+    }
+    emit(txQueueLengthSignal, txScheduler.getLength());
+
+    // Kalanlar için bir sonraki token zamanına timer kur
+    if (!txScheduler.isEmpty()) {
+        simtime_t next = txScheduler.getNextReadyTime(simTime());
+        if (!txTimer->isScheduled() || next < txTimer->getArrivalTime()) {
+            cancelEvent(txTimer);
+            scheduleAt(next, txTimer);
+        }
+    }
+}
+
+void LCC::transmit(Packet *packet, const L3Address& destAddr)
+{
+    // Replay modunda radyo kullanılmaz: alınacak her şey trace dosyasından gelir
+    if (traceReplaying) {
+        delete packet;
+        return;
+    }
+    socket.sendTo(packet, destAddr, destPort);
+}
+
+void LCC::countDrop(int reason)
+{
+    numDropped[reason]++;
+    emit(dataDroppedSignal, reason);
+}
+
+// ------------------------------------------------------------------
+// STORE-AND-FORWARD (Hold Buffer)
+// ------------------------------------------------------------------
+void LCC::holdOrDrop(int reason, const std::string& pktName, const Ptr<const LccData>& dataPkt, bool originated)
+{
+    if (!holdBuffer.isEnabled()) {
+        countDrop(reason);
+        return;
+    }
+
+    LccHoldBuffer::Entry entry;
+    entry.data = dataPkt;
+    entry.packetName = pktName;
+    entry.originated = originated;
+    entry.dropReason = reason;
+    entry.enqueueTime = simTime();
+    entry.deadline = simTime() + holdTime;
+
+    // Buffer dolu: politikaya göre yeni ya da en eski paket asıl nedeniyle drop
+    std::vector<LccHoldBuffer::Entry> evicted;
+    if (!holdBuffer.push(std::move(entry), evicted)) {
+        numHoldOverflow++;
+        countDrop(reason);
+        return;
+    }
+    for (auto const& old : evicted) {
+        numHoldOverflow++;
+        countDrop(old.dropReason);
+    }
+    numHeld++;
+    LCC_EV(LCC_LOG_PACKET) << "HOLD: rota yok, paket bekletiliyor (buffer: " << holdBuffer.getLength() << ")" << endl;
+    emit(holdBufferLengthSignal, holdBuffer.getLength());
+    scheduleHoldTimer();
+}
+
+void LCC::flushHoldBuffer()
+{
+    if (holdBuffer.isEmpty()) return;
+
+    // Sırayla tekrar yönlendir; hâlâ rotası olmayanlar aynı sırayla geri girer
+    std::vector<LccHoldBuffer::Entry> entries;
+    holdBuffer.takeAll(entries);
+    for (auto& entry : entries) {
+        if (entry.deadline <= simTime()) {
+            if (entry.enqueueTime >= warmupPeriod) {
+                numHoldExpired++;
+                countDrop(entry.dropReason);
+            }
+            continue;
+        }
+        // Kendi paketim: ilk hop henüz yok (numSent / hop kaydı gönderimde, warm-up kontrolüyle)
+        int reason = entry.originated ? dispatchOwnData(makePooled<LccData>(*entry.data))
+                                      : routeDataPacket(entry.packetName, entry.data);
+        if (reason != ROUTE_SENT) {
+            entry.dropReason = reason;
+            holdBuffer.restore(std::move(entry));
+            continue;
+        }
+        // Warm-up'ta bekletilen paket: hold sayaçları o sırada sıfırlandı
+        if (entry.enqueueTime < warmupPeriod) continue;
+        simtime_t wait = simTime() - entry.enqueueTime;
+        emit(holdWaitSignal, wait);
+        holdWaitSketch.add(wait.dbl());
+        numHoldFlushed++;
+    }
+    if ((int)entries.size() != holdBuffer.getLength()) {
+        LCC_EV(LCC_LOG_PACKET) << "HOLD FLUSH: " << entries.size() - holdBuffer.getLength() << " paket cikti" << endl;
+        emit(holdBufferLengthSignal, holdBuffer.getLength());
+    }
+    scheduleHoldTimer();
+}
+
+void LCC::expireHeldPackets()
+{
+    std::vector<LccHoldBuffer::Entry> expired;
+    holdBuffer.takeExpired(simTime(), expired);
+    for (auto const& entry : expired) {
+        if (entry.enqueueTime < warmupPeriod) continue;   // warm-up paketi: sayaçlar sıfırlandı
+        numHoldExpired++;
+        countDrop(entry.dropReason);
+    }
+    emit(holdBufferLengthSignal, holdBuffer.getLength());
+    scheduleHoldTimer();
+}
+
+void LCC::scheduleHoldTimer()
+{
+    // Timer her zaman en yakın deadline'da (buffer boşsa kurulmaz)
+    simtime_t next = holdBuffer.getEarliestDeadline();
+    if (holdTimer->isScheduled() && holdTimer->getArrivalTime() == next) return;
+    cancelEvent(holdTimer);
+    if (!holdBuffer.isEmpty())
+        scheduleAt(next, holdTimer);
+}
+
+void LCC::replayNextArrival()
+{
+    // Aynı zaman damgasına sahip tüm kayıtları sırayla teslim et
+    while (traceReader.hasNext() && traceReader.getNextArrivalTime() <= simTime()) {
+        Packet *packet = traceReader.takeNext();
+        socketDataArrived(&socket, packet);
+    }
+    if (traceReader.hasNext())
+        scheduleAt(traceReader.getNextArrivalTime(), replayTimer);
+}
+
+// ------------------------------------------------------------------
+// HOP KAYDI (Path Tracing)
+// ------------------------------------------------------------------
+Ptr<LccData> LCC::forwardCopy(const Ptr<const LccData>& dataPkt, int hopKind)
+{
+    auto copy = makePooled<LccData>(*dataPkt);
+    copy->setHopLimit(dataPkt->getHopLimit() - 1);
+    appendHop(copy, hopKind);
+    return copy;
+}
+
+void LCC::appendHop(const Ptr<LccData>& data, int hopKind)
+{
+    if (!data->getTraceHops() || (int)data->getHopIdsArraySize() >= maxHopRecords) return;
+
+    data->appendHopIds(myId);
+    data->appendHopRoles(myRole);
+    data->appendHopKinds(hopKind);
+    data->appendHopTimes(simTime());
+    data->setChunkLength(data->getChunkLength() + B(16)); // id + role + kind + zaman
+}
+
+void LCC::recordHopSegments(const Ptr<const LccData>& dataPkt)
+{
+    // i. kayıttan bir sonrakine (son kayıt için bana) geçen süre,
+    // i. node'un kullandığı bacağın (hopKind) segmentine yazılır
+    int n = dataPkt->getHopIdsArraySize();
+    for (int i = 0; i < n; i++) {
+        simtime_t nextTime = (i + 1 < n) ? dataPkt->getHopTimes(i + 1) : simTime();
+        int kind = dataPkt->getHopKinds(i);
+        if (kind < 0 || kind >= NUM_HOP_KINDS) continue;
+        segmentDelay[kind] += (nextTime - dataPkt->getHopTimes(i)).dbl();
+        segmentCount[kind]++;
+    }
+    numHopTraced++;
+    totalHopCount += n;
+    emit(hopCountSignal, n);
 }
 
 // ------------------------------------------------------------------
@@ -277,6 +1051,7 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
     std::string packetId = std::to_string(dataPkt->getSrcId()) + ":" + std::to_string(dataPkt->getSeqNo());
 
     if (seenPackets.find(packetId) != seenPackets.end()) {
+        countDrop(DROP_DUPLICATE);
         return;
     }
     seenPackets[packetId] = simTime();
@@ -285,7 +1060,10 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
     // 2. HEDEF KONTROLÜ
     // ------------------------------------------------------------------
     if (dataPkt->getDestId() == myId) {
-        EV << "SUCCESS: Paket bana (" << myId << ") ulasti! Kaynak: " << dataPkt->getSrcId() << endl;
+        LCC_EV(LCC_LOG_PACKET) << "SUCCESS: Paket bana (" << myId << ") ulasti! Kaynak: " << dataPkt->getSrcId() << endl;
+
+        // Warm-up içinde gönderilen paket: sayaçları sıfırlandığı için sayılmaz
+        if (dataPkt->getSendTime() < warmupPeriod) return;
 
         emit(pdrSignal, 1.0);
         emit(rttSignal, simTime() - dataPkt->getSendTime());
@@ -293,40 +1071,99 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
         numReceived++;
         simtime_t delay = simTime() - dataPkt->getSendTime();
         totalDelay += delay.dbl();
+        delaySketch.add(delay.dbl());
 
         totalBytesReceived += packet->getByteLength();
+        if (!receptionBins.empty()) {
+            // Gönderim zamanından sonraki ilk kopya -> kova (MSER kesmesi için)
+            auto it = std::upper_bound(counterSnapshots.begin(), counterSnapshots.end(), dataPkt->getSendTime(),
+                                       [](simtime_t t, const CounterSnapshot& s) { return t < s.time; });
+            ReceptionBin& bin = receptionBins[it - counterSnapshots.begin()];
+            bin.received++;
+            bin.totalDelay += delay.dbl();
+            bin.bytesReceived += packet->getByteLength();
+        }
+        if (dataPkt->getTraceHops())
+            recordHopSegments(dataPkt);
+        return;
+    }
+
+    // ------------------------------------------------------------------
+    // 2b. HOP LIMIT (Early Drop): Buradan sonrası sadece forwarding
+    // ------------------------------------------------------------------
+    if (dataPkt->getHopLimit() <= 1) {
+        LCC_EV(LCC_LOG_PACKET) << "DROP: Hop limit tukendi (" << packetId << ")" << endl;
+        countDrop(DROP_TTL);
         return;
     }
 
+    // ------------------------------------------------------------------
+    // 2c. YÖNLENDİRME: rota yoksa drop yerine hold buffer
+    // ------------------------------------------------------------------
+    int reason = routeDataPacket(packet->getName(), dataPkt);
+    if (reason != ROUTE_SENT)
+        holdOrDrop(reason, packet->getName(), dataPkt, false);
+}
+
+// Forwarding kararı: paket gönderildiyse ROUTE_SENT, rota yoksa LccDropReason
+// (drop / hold kararı çağırana kalır). Rota yokken hiçbir şey gönderilmez.
+int LCC::routeDataPacket(const std::string& pktName, const Ptr<const LccData>& dataPkt)
+{
     // ------------------------------------------------------------------
     // 3. MEMBER (ÜYE) DAVRANIŞI (Rol: 1)
     // ------------------------------------------------------------------
     if (myRole == 1) {
-        std::string pktName = packet->getName();
-
         if (pktName == "InterClusterData") {
-            if (foreignNeighbors.empty()) return;
+            // k-hop: hedef cluster'ı doğrudan görmüyorsam alt ağaçtaki gateway'e in
+            if (clusterHops > 1) {
+                bool seesTarget = false;
+                for (auto const& [neighborId, foreignCH] : foreignNeighbors)
+                    if (foreignCH == dataPkt->getTargetClusterId()) { seesTarget = true; break; }
+                int child = seesTarget ? -1 : gatewayChild(dataPkt->getTargetClusterId());
+                if (child != -1) {
+                    Packet *downPkt = new Packet("InterClusterData");
+                    downPkt->insertAtBack(forwardCopy(dataPkt, HOP_CH_TO_GATEWAY));
+                    sendPacket(downPkt, hostAddress(child), TX_INTER);
+                    return ROUTE_SENT;
+                }
+            }
+
+            // Backbone: tüm yabancı komşular yerine hedef cluster'ın tek giriş node'u
+            if (useBackbone && dataPkt->getTargetClusterId() != -1) {
+                int entryId = backboneEntry(dataPkt->getTargetClusterId());
+                if (entryId == -1) return DROP_NO_ROUTE;
+                Packet *outPkt = new Packet("GatewayForward");
+                outPkt->insertAtBack(forwardCopy(dataPkt, HOP_GATEWAY_TO_FOREIGN));
+                sendPacket(outPkt, hostAddress(entryId), TX_INTER);
+                return ROUTE_SENT;
+            }
+
+            if (foreignNeighbors.empty()) return DROP_NO_ROUTE;
 
             for (auto const& [neighborId, foreignCH] : foreignNeighbors) {
                  Packet *outPkt = new Packet("GatewayForward");
-                 outPkt->insertAtBack(makeShared<LccData>(*dataPkt));
+                 outPkt->insertAtBack(forwardCopy(dataPkt, HOP_GATEWAY_TO_FOREIGN));
 
-                 std::string gwNeighborName = "host[" + std::to_string(neighborId) + "]";
-                 L3Address neighborAddr = L3AddressResolver().resolve(gwNeighborName.c_str());
-                 socket.sendTo(outPkt, neighborAddr, destPort);
+                 L3Address neighborAddr = hostAddress(neighborId);
+                 sendPacket(outPkt, neighborAddr, TX_INTER);
             }
-            return;
+            return ROUTE_SENT;
         }
 
-        if (myClusterHeadId != -1) {
+        // k-hop: CH'den alt ağacıma inen paket
+        if (pktName == "IntraDown") {
+            return forwardDown(dataPkt) ? ROUTE_SENT : DROP_NO_ROUTE;
+        }
+
+        if (upstreamHop() != -1) {
             Packet *relayPkt = new Packet("RelayToCH");
-            relayPkt->insertAtBack(makeShared<LccData>(*dataPkt));
+            relayPkt->insertAtBack(forwardCopy(dataPkt, HOP_MEMBER_TO_CH));
 
-            std::string chName = "host[" + std::to_string(myClusterHeadId) + "]";
-            L3Address chAddr = L3AddressResolver().resolve(chName.c_str());
-            socket.sendTo(relayPkt, chAddr, destPort);
+            L3Address chAddr = hostAddress(upstreamHop());
+            sendPacket(relayPkt, chAddr, TX_INTRA);
+            return ROUTE_SENT;
         }
-        return;
+        return DROP_NO_CH;
     }
 
     // ------------------------------------------------------------------
@@ -337,14 +1174,17 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
         // A) Hedef Benim Üyem mi? (Local Delivery)
         if (neighborsLastSeen.find(dataPkt->getDestId()) != neighborsLastSeen.end()) {
             Packet *finalPkt = new Packet("FinalDelivery");
-            finalPkt->insertAtBack(makeShared<LccData>(*dataPkt));
+            finalPkt->insertAtBack(forwardCopy(dataPkt, HOP_CH_TO_DEST));
 
-            std::string destName = "host[" + std::to_string(dataPkt->getDestId()) + "]";
-            L3Address destAddr = L3AddressResolver().resolve(destName.c_str());
-            socket.sendTo(finalPkt, destAddr, destPort);
-            return;
+            L3Address destAddr = hostAddress(dataPkt->getDestId());
+            sendPacket(finalPkt, destAddr, TX_INTRA);
+            return ROUTE_SENT;
         }
 
+        // A2) k-hop: hedef cluster ağacımda birkaç hop aşağıda
+        if (clusterHops > 1 && mySubtree.contains(dataPkt->getDestId()) && forwardDown(dataPkt))
+            return ROUTE_SENT;
+
         // B) HEDEF BAŞKA CLUSTER'DA -> AKILLI GATEWAY SEÇİMİ (SMART FLOODING)
         bool sentViaGateway = false;
 
@@ -352,49 +1192,41 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
         // Bir node'a aynı paket için sadece BİR KERE görev verilir.
         std::vector<int> usedGateways;
 
-        for (auto const& [targetClusterId, gateways] : clusterRoutingTable) {
-            if (gateways.empty()) continue;
+        // Backbone: her komşu cluster'a sadece seçili gateway üzerinden
+        if (useBackbone) {
+            for (auto const& [targetClusterId, gatewayId] : backboneGateways) {
+                Packet *interClusterPkt = new Packet("InterClusterData");
+                auto interClusterData = forwardCopy(dataPkt, HOP_CH_TO_GATEWAY);
+                interClusterData->setTargetClusterId(targetClusterId);
+                interClusterPkt->insertAtBack(interClusterData);
+                sendPacket(interClusterPkt, hostAddress(gatewayId), TX_INTER);
+                sentViaGateway = true;
+            }
+        }
+        else {
+            for (auto const& [targetClusterId, gateways] : clusterRoutingTable) {
+                if (gateways.empty()) continue;
 
-            int selectedGw = -1;
+                int selectedGw = selectGateway(gateways, usedGateways);
 
-            // Aday listesini kopyala (orijinalini bozmayalım)
-            std::vector<int> candidates = gateways;
+                if (selectedGw != -1) {
+                    Packet *interClusterPkt = new Packet("InterClusterData");
+                    auto interClusterData = forwardCopy(dataPkt, HOP_CH_TO_GATEWAY);
+                    interClusterData->setTargetClusterId(targetClusterId);
+                    interClusterPkt->insertAtBack(interClusterData);
 
-            // Adayları rastgele sırayla dene (Yük dağılımı için)
-            while (!candidates.empty()) {
-                // Rastgele bir aday seç
-                int randIndex = intuniform(0, candidates.size() - 1);
-                int candidateId = candidates[randIndex];
+                    L3Address gwAddr = hostAddress(selectedGw);
+                    sendPacket(interClusterPkt, gwAddr, TX_INTER);
 
-                bool alreadyUsed = false;
-                for (int u : usedGateways) {
-                    if (u == candidateId) { alreadyUsed = true; break; }
-                }
+                    usedGateways.push_back(selectedGw);
+                    sentViaGateway = true;
 
-                if (!alreadyUsed) {
-                    selectedGw = candidateId;
-                    break;
-                } else {
-                    candidates.erase(candidates.begin() + randIndex);
                 }
-            }
-
-            if (selectedGw != -1) {
-                Packet *interClusterPkt = new Packet("InterClusterData");
-                interClusterPkt->insertAtBack(makeShared<LccData>(*dataPkt));
-
-                std::string gwName = "host[" + std::to_string(selectedGw) + "]";
-                L3Address gwAddr = L3AddressResolver().resolve(gwName.c_str());
-                socket.sendTo(interClusterPkt, gwAddr, destPort);
-
-                usedGateways.push_back(selectedGw);
-                sentViaGateway = true;
+                else {
 
-            }
-            else {
-
-                if (!gateways.empty()) {
-                    sentViaGateway = true;
+                    if (!gateways.empty()) {
+                        sentViaGateway = true;
+                    }
                 }
             }
         }
@@ -408,18 +1240,144 @@ void LCC::processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt)
                     int luckyNeighborId = neighborsLastSeen.begin()->first;
 
                     Packet *rescuePkt = new Packet("EmergencyRelay");
-                    rescuePkt->insertAtBack(makeShared<LccData>(*dataPkt));
-
-                    std::string neighborName = "host[" + std::to_string(luckyNeighborId) + "]";
-                    L3Address neighborAddr = L3AddressResolver().resolve(neighborName.c_str());
-                    socket.sendTo(rescuePkt, neighborAddr, destPort);
+                    rescuePkt->insertAtBack(forwardCopy(dataPkt, HOP_EMERGENCY));
 
+                    L3Address neighborAddr = hostAddress(luckyNeighborId);
+                    sendPacket(rescuePkt, neighborAddr, TX_INTER);
+                    return ROUTE_SENT;
                 }
             }
+            return DROP_NO_ROUTE;
+        }
+        return ROUTE_SENT;
+    }
+
+    // Undecided: paketi iletecek bir CH yok
+    return DROP_NO_CH;
+}
+
+bool LCC::forwardDown(const Ptr<const LccData>& dataPkt)
+{
+    int destId = dataPkt->getDestId();
+    if (neighborsLastSeen.find(destId) != neighborsLastSeen.end()) {
+        Packet *finalPkt = new Packet("FinalDelivery");
+        finalPkt->insertAtBack(forwardCopy(dataPkt, HOP_CH_TO_DEST));
+        sendPacket(finalPkt, hostAddress(destId), TX_INTRA);
+        return true;
+    }
+
+    int child = downstreamHop(destId);
+    if (child == -1) return false;
+    Packet *downPkt = new Packet("IntraDown");
+    downPkt->insertAtBack(forwardCopy(dataPkt, HOP_CH_TO_DEST));
+    sendPacket(downPkt, hostAddress(child), TX_INTRA);
+    return true;
+}
+
+int LCC::selectGateway(const std::vector<int>& gateways, const std::vector<int>& usedGateways)
+{
+    auto isUsed = [&](int id) {
+        for (int u : usedGateways)
+            if (u == id) return true;
+        return false;
+    };
+
+    // Aday listesini kopyala (orijinalini bozmayalım)
+    std::vector<int> candidates = gateways;
+
+    // Link kalitesi açıksa: sağlam linkli kullanılmamış aday varsa marjinaller elenir
+    if (useLinkQuality) {
+        std::vector<int> stableCandidates;
+        for (int candidateId : candidates)
+            if (!isUsed(candidateId) && isStableLink(candidateId)) stableCandidates.push_back(candidateId);
+        if (!stableCandidates.empty()) candidates.swap(stableCandidates);
+    }
+
+    // Mobilite tahmini açıksa: linki en uzun yaşayacak kullanılmamış gateway
+    if (useMobilityPrediction) {
+        int best = -1;
+        simtime_t bestLifetime = -1.0;
+        for (int candidateId : candidates) {
+            if (isUsed(candidateId)) continue;
+            simtime_t lifetime = remainingLinkLifetime(candidateId);
+            if (lifetime > bestLifetime) { best = candidateId; bestLifetime = lifetime; }
+        }
+        return best;
+    }
+
+    // Adayları rastgele sırayla dene (Yük dağılımı için)
+    while (!candidates.empty()) {
+        // Rastgele bir aday seç
+        int randIndex = intuniform(0, candidates.size() - 1);
+        int candidateId = candidates[randIndex];
+
+        if (!isUsed(candidateId))
+            return candidateId;
+        candidates.erase(candidates.begin() + randIndex);
+    }
+    return -1;
+}
+
+// ------------------------------------------------------------------
+// BACKBONE (CDS: CH'ler + cluster çifti başına tek gateway)
+// ------------------------------------------------------------------
+void LCC::pruneGateway(int gatewayId, const LccBeacon *beacon)
+{
+    // beacon: gateway'in son raporu (sadece raporlamadığı hedeflerden çıkar),
+    // nullptr: gateway artık üyem/komşum değil (tüm hedeflerden çıkar)
+    for (auto it = clusterRoutingTable.begin(); it != clusterRoutingTable.end(); ++it) {
+        int targetClusterId = it->first;
+        bool stillSeen = false;
+        for (size_t k = 0; beacon && k < beacon->getSeenClusterIdsArraySize() && !stillSeen; k++)
+            stillSeen = beacon->getSeenClusterIds(k) == targetClusterId;
+        if (stillSeen) continue;
+        std::vector<int>& gateways = it->second;
+        gateways.erase(std::remove(gateways.begin(), gateways.end(), gatewayId), gateways.end());
+    }
+}
+
+void LCC::updateBackbone()
+{
+    // Hedef başına seçili gateway: hâlâ aday ve link kullanılabilirse korunur
+    // (backbone gereksiz yere değişmez), değilse en düşük ID'li uygun aday
+    for (auto it = clusterRoutingTable.begin(); it != clusterRoutingTable.end(); ) {
+        int targetClusterId = it->first;
+        const std::vector<int>& gateways = it->second;
+        if (gateways.empty()) {
+            backboneGateways.erase(targetClusterId);
+            it = clusterRoutingTable.erase(it);
+            continue;
+        }
+
+        auto current = backboneGateways.find(targetClusterId);
+        bool keep = current != backboneGateways.end() && isUsableLink(current->second)
+                && std::find(gateways.begin(), gateways.end(), current->second) != gateways.end();
+        if (!keep) {
+            int best = -1;
+            for (int gw : gateways)
+                if (isUsableLink(gw) && (best == -1 || gw < best)) best = gw;
+            if (best == -1) best = *std::min_element(gateways.begin(), gateways.end());
+            if (current == backboneGateways.end() || current->second != best) {
+                LCC_EV(LCC_LOG_INFO) << "BACKBONE: cluster " << targetClusterId << " icin gateway " << best << endl;
+            }
+            backboneGateways[targetClusterId] = best;
         }
+        ++it;
     }
 }
 
+int LCC::backboneEntry(int targetClusterId) const
+{
+    // Hedef CH doğrudan komşumsa o; değilse o cluster'daki en düşük ID'li uygun komşu
+    int entryId = -1;
+    for (auto const& [neighborId, foreignCH] : foreignNeighbors) {
+        if (foreignCH != targetClusterId) continue;
+        if (neighborId == targetClusterId) return neighborId;
+        if (entryId == -1 && isUsableLink(neighborId)) entryId = neighborId;
+    }
+    return entryId;
+}
+
 // ------------------------------------------------------------------
 // STANDART LCC FONKSİYONLARI
 // ------------------------------------------------------------------
@@ -428,41 +1386,219 @@ void LCC::checkTimeouts()
     simtime_t now = simTime();
     bool myClusterHeadLost = false;
 
-    // Normal Komşular
-    for (auto it = neighborsLastSeen.begin(); it != neighborsLastSeen.end(); ) {
-        if (now - it->second > neighborValidityInterval) {
-            if (myRole == 1 && it->first == myClusterHeadId) myClusterHeadLost = true;
-            neighborsRoles.erase(it->first);
-            it = neighborsLastSeen.erase(it);
-        } else { ++it; }
+    // Normal Komşular: süre aşımı + üye/CH maskeleri tek geçişte (now - lastSeen > validity).
+    // Çekirdek neighborsLastSeen'in raw dizisini doğrudan okur (olmayan id'lerdeki
+    // eski değerler present maskesiyle elenir)
+    lccScanNeighbors(neighborsLastSeen.data(), neighborsRoles.data(),
+                     neighborsLastSeen.keys().words(), numHosts, (now - neighborValidityInterval).raw(), neighborScan);
+    if (neighborScan.numExpired > 0) {
+        if (myRole == 1 && clusterHops == 1 && lccMaskTest(neighborScan.expired, myClusterHeadId)) {
+            myClusterHeadLost = true;
+            beginOutage(SimTime::fromRaw(neighborsLastSeen.find(myClusterHeadId)->second));
+        }
+        const uint64_t *expired = neighborScan.expired.data();
+        size_t numWords = neighborScan.expired.size();
+        neighborsLastSeen.eraseMask(expired, numWords);
+        neighborsRoles.eraseMask(expired, numWords);
+        linkExpiry.eraseMask(expired, numWords);
+        linkQuality.eraseMask(expired, numWords);
+        neighborBeaconDigest.eraseMask(expired, numWords);
+        neighborAdverts.eraseMask(expired, numWords);
     }
 
     // Yabancı Komşular
-    for (auto it = foreignNeighbors.begin(); it != foreignNeighbors.end(); ) {
-        if (neighborsLastSeen.find(it->first) == neighborsLastSeen.end()) {
-            it = foreignNeighbors.erase(it);
-        } else { ++it; }
-    }
+    foreignNeighbors.retainKeys(neighborsLastSeen.keys());
 
     if (foreignNeighbors.empty()) isGateway = false;
 
-    if (myClusterHeadLost) {
-        if (myRole == 2) emit(chLifetimeSignal, simTime() - chStartTime);
+    // Backbone: süresi dolan gateway'ler düşer, seçim link durumuna göre tazelenir
+    if (useBackbone) {
+        if (myRole == 2) {
+            for (int id = lccMaskNext(neighborScan.expired, 0); id >= 0; id = lccMaskNext(neighborScan.expired, id + 1))
+                pruneGateway(id, nullptr);
+            updateBackbone();
+        }
+        else {
+            clusterRoutingTable.clear();
+            backboneGateways.clear();
+        }
+    }
+
+    if (myClusterHeadLost && useChHandover && handoverToBackup()) {
+        // Yedek CH'ye geçildi: yeniden seçim yok
+    }
+    else if (myClusterHeadLost) {
+        if (myRole == 2) {
+            emit(chLifetimeSignal, simTime() - chStartTime);
+            chLifetimeSketch.add((simTime() - chStartTime).dbl());
+        }
         if (myRole != 0) emit(chChangeSignal, 1);
         myRole = 0;
         myClusterHeadId = -1;
     }
-    runLCCLogic();
+    else if ((useMobilityPrediction || useLinkQuality) && myRole == 1 && clusterHops == 1) {
+        proactiveReaffiliation();
+    }
+    // k-hop: CH komşu olmak zorunda değil; CH kaybı ve parent seçimi runKHopLogic'te
+    if (clusterHops > 1) runKHopLogic();
+    else runLCCLogic();
+    noteAffiliation();
+    flushHoldBuffer();
     updateVisuals();
 }
 
+// ------------------------------------------------------------------
+// MOBİLİTE TAHMİNİ (Link Ömrü)
+// ------------------------------------------------------------------
+simtime_t LCC::remainingLinkLifetime(int neighborId) const
+{
+    auto it = linkExpiry.find(neighborId);
+    if (it == linkExpiry.end() || it->second == SIMTIME_MAX) return SIMTIME_MAX;
+    return (it->second > simTime()) ? it->second - simTime() : SIMTIME_ZERO;
+}
+
+bool LCC::isLongLivedLink(int neighborId) const
+{
+    if (!useMobilityPrediction) return true;
+    return remainingLinkLifetime(neighborId) >= minLinkLifetime;
+}
+
+// ------------------------------------------------------------------
+// LİNK KALİTESİ (SNIR EWMA)
+// ------------------------------------------------------------------
+void LCC::updateLinkQuality(int neighborId, double snirDb)
+{
+    auto it = linkQuality.find(neighborId);
+    if (it == linkQuality.end()) {
+        // İlk örnek: EWMA onunla başlar, durum iyi eşiğe göre belirlenir
+        linkQuality[neighborId] = { snirDb, snirDb >= snirGoodThreshold };
+        return;
+    }
+
+    LinkQuality& q = it->second;
+    q.snirDb = linkQualityAlpha * snirDb + (1 - linkQualityAlpha) * q.snirDb;
+
+    // Histerezis: iki eşik arasında kalan link önceki durumunu korur
+    if (q.stable && q.snirDb < snirBadThreshold) q.stable = false;
+    else if (!q.stable && q.snirDb >= snirGoodThreshold) q.stable = true;
+}
+
+bool LCC::isStableLink(int neighborId) const
+{
+    if (!useLinkQuality) return true;
+    auto it = linkQuality.find(neighborId);
+    return it == linkQuality.end() || it->second.stable;   // ölçüm yoksa engelleme
+}
+
+bool LCC::proactiveReaffiliation()
+{
+    // CH linki kopmak üzere ya da marjinal: timeout beklemeden daha iyi bir CH'ye geç
+    bool expiring = useMobilityPrediction && remainingLinkLifetime(myClusterHeadId) < handoverMargin;
+    if (!expiring && isStableLink(myClusterHeadId)) return false;
+
+    int bestCh = -1;
+    for (auto const& [neighborId, role] : neighborsRoles) {
+        if (role == 2 && neighborId != myClusterHeadId && isUsableLink(neighborId)) {
+            bestCh = neighborId;   // map sıralı: ilk uygun = en düşük ID (LCC kuralı)
+            break;
+        }
+    }
+    if (bestCh == -1) {
+        // Komşu CH yok: yedek bensem liderliği CH'nin linki kopmadan devral
+        // (diğer üyeler yedeğe CH kaybında / CAST_DEPARTURE ile geçer)
+        if (useChHandover && myBackupChId == myId) {
+            beginOutage(simTime());
+            return handoverToBackup();
+        }
+        return false;
+    }
+
+    LCC_EV(LCC_LOG_INFO) << "HANDOVER: CH " << myClusterHeadId << " linki zayif -> CH " << bestCh << endl;
+    emit(chChangeSignal, 1);
+    myClusterHeadId = bestCh;
+    return true;
+}
+
+int LCC::selectBackupCh() const
+{
+    // Yedek: linki kullanılabilir üyeler arasından mobilite tahmini açıksa linki
+    // en uzun yaşayacak olan, değilse en düşük ID'li (yeniden seçimde de o kazanırdı)
+    int best = -1;
+    simtime_t bestLifetime = -1.0;
+    for (int memberId : myMembers) {
+        if (neighborsLastSeen.find(memberId) == neighborsLastSeen.end() || !isUsableLink(memberId)) continue;
+        if (!useMobilityPrediction) return memberId;
+        simtime_t lifetime = remainingLinkLifetime(memberId);
+        if (lifetime > bestLifetime) { best = memberId; bestLifetime = lifetime; }
+    }
+    return best;
+}
+
+bool LCC::handoverToBackup()
+{
+    int backupId = myBackupChId;
+    myBackupChId = -1;
+    if (backupId == myId) {
+        LCC_EV(LCC_LOG_INFO) << "HANDOVER: yedek CH benim, CH " << myClusterHeadId << " yerine liderligi devraliyorum" << endl;
+        myRole = 2;
+        myClusterHeadId = myId;
+        chStartTime = simTime();
+        numRoleChanges++;
+        emit(roleChangeSignal, 1);
+    }
+    else if (backupId != -1 && neighborsLastSeen.find(backupId) != neighborsLastSeen.end() && isUsableLink(backupId)) {
+        LCC_EV(LCC_LOG_INFO) << "HANDOVER: CH " << myClusterHeadId << " -> yedek CH " << backupId << endl;
+        myClusterHeadId = backupId;
+    }
+    else {
+        return false;
+    }
+    numHandovers++;
+    emit(chChangeSignal, 1);
+    return true;
+}
+
+void LCC::beginOutage(simtime_t since)
+{
+    if (inOutage) return;
+    inOutage = true;
+    outageStart = since;
+}
+
+void LCC::noteAffiliation()
+{
+    // Yeniden başlama: ilk rol (CH ya da Member) alınana kadar geçen süre
+    if (recovering && myRole != 0) {
+        emit(restartRecoverySignal, simTime() - restartTime);
+        recovering = false;
+    }
+
+    // Kesinti: CH'den son haber (ya da ayrılış) anından yeni CH'ye bağlanana kadar
+    if (!inOutage || myClusterHeadId == -1) return;
+    emit(chOutageSignal, simTime() - outageStart);
+    inOutage = false;
+}
+
+void LCC::forgetNeighbor(int neighborId)
+{
+    neighborsLastSeen.erase(neighborId);
+    neighborsRoles.erase(neighborId);
+    neighborBeaconDigest.erase(neighborId);
+    linkExpiry.erase(neighborId);
+    linkQuality.erase(neighborId);
+    neighborAdverts.erase(neighborId);
+    foreignNeighbors.erase(neighborId);
+}
+
 void LCC::runLCCLogic()
 {
     int oldRole = myRole;
     if (myRole == 0) {
+        // Komşular artan id sırasında: ilk uygun olan en düşük ID
         int lowestId = myId;
-        for (auto const& [neighborId, lastSeen] : neighborsLastSeen) {
-            if (neighborId < lowestId) lowestId = neighborId;
+        const LccNodeIdSet& neighbors = neighborsLastSeen.keys();
+        for (int neighborId = neighbors.next(0); neighborId < myId; neighborId = neighbors.next(neighborId + 1)) {
+            if (isUsableLink(neighborId)) { lowestId = neighborId; break; }
         }
         if (lowestId == myId) {
             myRole = 2; myClusterHeadId = myId; chStartTime = simTime();
@@ -471,34 +1607,159 @@ void LCC::runLCCLogic()
         }
     }
     else if (myRole == 2) {
-        int memberCount = 0;
-        for (auto const& [neighborId, role] : neighborsRoles) {
-            if (role == 1) memberCount++;
-            if (role == 2 && neighborId < myId) {
-                myRole = 1; myClusterHeadId = neighborId;
+        // checkTimeouts taramasının CH maskesinden benden düşük ilk uygun CH;
+        // üye sayısı (eski döngüdeki gibi) o CH'ye kadar olan üyeler
+        int memberCount = neighborScan.numMembers;
+        for (int headId = lccMaskNext(neighborScan.heads, 0); headId >= 0 && headId < myId; headId = lccMaskNext(neighborScan.heads, headId + 1)) {
+            if (isUsableLink(headId)) {
+                memberCount = lccMaskCountBelow(neighborScan.members, headId);
+                myRole = 1; myClusterHeadId = headId;
                 emit(chLifetimeSignal, simTime() - chStartTime);
+                chLifetimeSketch.add((simTime() - chStartTime).dbl());
                 break;
             }
         }
         emit(clusterSizeSignal, memberCount);
+        clusterSizeSketch.add(memberCount);
+    }
+    if (oldRole != myRole) {
+        numRoleChanges++;
+        emit(roleChangeSignal, 1);
     }
-    if (oldRole != myRole)
+}
+
+// ------------------------------------------------------------------
+// K-HOP KÜMELEME (clusterHops > 1)
+// ------------------------------------------------------------------
+bool LCC::findClusterHeadPath(int chId, int& via, int& hops) const
+{
+    // chId'yi (hops-1) uzaklıkta duyuran, parent'ı ben olmayan komşular
+    // arasından en kısa yol; eşitlikte en düşük ID
+    via = -1;
+    for (auto const& [neighborId, advert] : neighborAdverts) {
+        if (advert.clusterHeadId != chId || advert.parentId == myId) continue;
+        int h = advert.chHops + 1;
+        if (h > clusterHops || !isUsableLink(neighborId)) continue;
+        if (via == -1 || h < hops) { via = neighborId; hops = h; }
+    }
+    return via != -1;
+}
+
+void LCC::runKHopLogic()
+{
+    int oldRole = myRole;
+
+    // Member: CH k hop içinde kaldıkça değişmez (LCC), sadece parent tazelenir
+    if (myRole == 1) {
+        int via, hops;
+        if (findClusterHeadPath(myClusterHeadId, via, hops)) {
+            myParentId = via; myChHops = hops;
+        }
+        else {
+            LCC_EV(LCC_LOG_INFO) << "K-HOP: CH " << myClusterHeadId << " artik " << clusterHops << " hop icinde degil" << endl;
+            emit(chChangeSignal, 1);
+            myRole = 0; myClusterHeadId = -1; myParentId = -1; myChHops = 0;
+        }
+    }
+
+    // k hop içinde duyurulan en düşük ID'li CH (eşitlikte en kısa yol)
+    int bestCh = -1, bestVia = -1, bestHops = 0;
+    for (auto const& [neighborId, advert] : neighborAdverts) {
+        int ch = advert.clusterHeadId;
+        if (ch < 0 || ch == myId || advert.parentId == myId || advert.chHops + 1 > clusterHops) continue;
+        if (bestCh != -1 && (ch > bestCh || (ch == bestCh && advert.chHops + 1 >= bestHops))) continue;
+        if (!isUsableLink(neighborId)) continue;
+        bestCh = ch; bestVia = neighborId; bestHops = advert.chHops + 1;
+    }
+
+    if (myRole == 0) {
+        // Benden düşük ID'li kararsız komşu varsa önce o karar verir (1-hop LCC sırası)
+        bool waitForLower = false;
+        for (auto const& [neighborId, role] : neighborsRoles) {
+            if (neighborId >= myId) break;
+            if (role == 0 && isUsableLink(neighborId)) { waitForLower = true; break; }
+        }
+        if (bestCh != -1 && bestCh < myId) {
+            myRole = 1; myClusterHeadId = bestCh; myParentId = bestVia; myChHops = bestHops;
+        }
+        else if (!waitForLower) {
+            myRole = 2; myClusterHeadId = myId; myParentId = -1; myChHops = 0; chStartTime = simTime();
+        }
+    }
+    else if (myRole == 2) {
+        if (bestCh != -1 && bestCh < myId) {
+            LCC_EV(LCC_LOG_INFO) << "K-HOP: CH " << bestCh << " " << bestHops << " hop uzakta -> liderligi birak" << endl;
+            emit(chLifetimeSignal, simTime() - chStartTime);
+            chLifetimeSketch.add((simTime() - chStartTime).dbl());
+            myRole = 1; myClusterHeadId = bestCh; myParentId = bestVia; myChHops = bestHops;
+        }
+    }
+
+    updateSubtree();
+    if (oldRole == 2) {
+        emit(clusterSizeSignal, mySubtree.size());
+        clusterSizeSketch.add(mySubtree.size());
+    }
+    if (oldRole != myRole) {
         numRoleChanges++;
+        emit(roleChangeSignal, 1);
+    }
+}
+
+void LCC::updateSubtree()
+{
+    // Alt ağaç: parent'ı ben olan komşular + onların duyurduğu alt ağaçlar
+    mySubtree.clear();
+    if (myRole == 0) return;
+    for (auto const& [neighborId, advert] : neighborAdverts) {
+        if (!isChild(advert)) continue;
+        mySubtree.insert(neighborId);
+        for (int id : advert.subtree)
+            if (id != myId && id >= 0 && id < numHosts) mySubtree.insert(id);
+    }
+}
+
+int LCC::downstreamHop(int destId) const
+{
+    for (auto const& [neighborId, advert] : neighborAdverts) {
+        if (!isChild(advert)) continue;
+        if (neighborId == destId) return neighborId;
+        for (int id : advert.subtree)
+            if (id == destId) return neighborId;
+    }
+    return -1;
+}
+
+int LCC::gatewayChild(int targetClusterId) const
+{
+    for (auto const& [neighborId, advert] : neighborAdverts) {
+        if (!isChild(advert)) continue;
+        for (int clusterId : advert.seenClusters)
+            if (clusterId == targetClusterId) return neighborId;
+    }
+    return -1;
 }
 
 void LCC::updateVisuals()
 {
+#ifndef LCC_HEADLESS
     if (!getParentModule()->getCanvas()) return;
     const char* color = "gray";
     if (myRole == 2) color = "red";
     else if (myRole == 1) {
         if (isGateway) color = "blue"; else color = "green";
     }
+    if (color == shownColor) return;   // aynı renk: display string'e dokunma
+    shownColor = color;
     getParentModule()->getDisplayString().setTagArg("i", 1, color);
+#endif
 }
 
 void LCC::finish()
 {
+    traceWriter.close();
+    traceReader.close();
+
     // 1. PDR Hesabı
     double pdr = (numSent > 0) ? (double)numReceived / numSent * 100.0 : 0.0;
 
@@ -506,13 +1767,15 @@ void LCC::finish()
     double avgDelay = (numReceived > 0) ? totalDelay / numReceived : 0.0;
 
     // 3. Throughput (Bits per Second - bps)
-    double throughput = (simTime().dbl() > 0) ? (totalBytesReceived * 8.0) / simTime().dbl() : 0.0;
+    double measuredTime = (simTime() - warmupPeriod).dbl();
+    double throughput = (measuredTime > 0) ? (totalBytesReceived * 8.0) / measuredTime : 0.0;
 
     // 4. Dosyaya Yazma (Append Modu)
     std::ofstream resultFile;
-    resultFile.open("manual_results.csv", std::ios::out | std::ios::app);
+    resultFile.open(resultFilePrefix + "_results.csv", std::ios::out | std::ios::app);
 
-    // NodeID, Sent, Received, PDR, AvgDelay, Throughput, BeaconsSent, RoleChanges
+    // NodeID, Sent, Received, PDR, AvgDelay, Throughput, BeaconsSent, RoleChanges,
+    // DropTtl, DropDuplicate, DropNoRoute, DropNoCh
     if (resultFile.is_open()) {
         resultFile << myId << ","
                    << numSent << ","
@@ -521,9 +1784,336 @@ void LCC::finish()
                    << avgDelay << ","
                    << throughput << ","
                    << numBeaconsSent << ","
-                   << numRoleChanges << "\n";
+                   << numRoleChanges << ","
+                   << numDropped[DROP_TTL] << ","
+                   << numDropped[DROP_DUPLICATE] << ","
+                   << numDropped[DROP_NO_ROUTE] << ","
+                   << numDropped[DROP_NO_CH] << "\n";
         resultFile.close();
     }
+
+    // 5. Dağılımlar: node bazlı quantile'lar + ağ geneli birleştirme için sketch dökümü
+    recordQuantiles("endToEndDelay", delaySketch);
+    recordQuantiles("chLifetime", chLifetimeSketch);
+    recordQuantiles("clusterSize", clusterSizeSketch);
+    recordQuantiles("holdWait", holdWaitSketch);
+    recordSegmentStats();
+    // Ölçüm pencereleri: sayaçlar/CSV warmupPeriod'dan (MSER: kesme noktası),
+    // dağılım / segment / hold istatistikleri son sıfırlamadan (MSER: tespit anı)
+    recordScalar("countersWindowStart", warmupPeriod);
+    recordScalar("distributionsWindowStart", statisticsResetTime);
+    recordScalar("txQueueDrops", (double)numTxQueueDrops);
+    recordScalar("clusterCastsSent", (double)numClusterCastsSent);
+    recordScalar("clusterCastDiscarded", (double)numClusterCastDiscarded);
+    recordScalar("interClusterTx", (double)numInterClusterTx);
+    recordScalar("chHandovers", (double)numHandovers);
+    recordScalar("restarts", (double)numRestarts);
+    recordScalar("holdBuffered", (double)numHeld);
+    recordScalar("holdFlushed", (double)numHoldFlushed);
+    recordScalar("holdExpired", (double)numHoldExpired);
+    recordScalar("holdOverflow", (double)numHoldOverflow);
+
+    // Havuz process geneli: bir kez (node 0) kaydedilir
+    if (myId == 0) {
+        recordScalar("chunkPoolHits", (double)LccChunkPool::getHits());
+        recordScalar("chunkPoolMisses", (double)LccChunkPool::getMisses());
+        recordScalar("chunkPoolPeakBytes", (double)LccChunkPool::getPeakBytes());
+        LccChunkPool::releaseAll();
+    }
+
+    // NodeID, Metric, <sketch> (merge_sketches.py ile run bazında birleştirilir)
+    std::ofstream sketchFile(resultFilePrefix + "_sketches.csv", std::ios::out | std::ios::app);
+    if (sketchFile.is_open()) {
+        sketchFile.precision(12);
+        const std::pair<const char *, const LccQuantileSketch *> sketches[] = {
+            {"endToEndDelay", &delaySketch}, {"chLifetime", &chLifetimeSketch}, {"clusterSize", &clusterSizeSketch},
+            {"holdWait", &holdWaitSketch}
+        };
+        for (auto const& [name, sketch] : sketches) {
+            sketchFile << myId << "," << name << ",";
+            sketch->writeCsv(sketchFile);
+            sketchFile << "\n";
+        }
+    }
+}
+
+void LCC::recordSegmentStats()
+{
+    static const char *segmentNames[NUM_HOP_KINDS] = {
+        "MemberToCH", "CHToGateway", "GatewayToForeign", "CHToDest", "Emergency", "Direct"
+    };
+
+    if (numHopTraced == 0) return;
+    recordScalar("hopCount:mean", (double)totalHopCount / numHopTraced);
+
+    // NodeID, Segment, Count, TotalDelay (Append Modu)
+    std::ofstream segmentFile(resultFilePrefix + "_segments.csv", std::ios::out | std::ios::app);
+    for (int k = 0; k < NUM_HOP_KINDS; k++) {
+        if (segmentCount[k] == 0) continue;
+        std::string name = std::string("segmentDelay:") + segmentNames[k];
+        recordScalar((name + ":mean").c_str(), segmentDelay[k] / segmentCount[k]);
+        recordScalar((name + ":count").c_str(), (double)segmentCount[k]);
+        if (segmentFile.is_open())
+            segmentFile << myId << "," << segmentNames[k] << "," << segmentCount[k] << "," << segmentDelay[k] << "\n";
+    }
+}
+
+// ------------------------------------------------------------------
+// WARM-START SNAPSHOT
+// ------------------------------------------------------------------
+// Metin formatı (node başına bir dosya, zamanlar snapshot anına göre "yaş"):
+//   LCCSNAP1 <id>
+//   pos <x> <y>
+//   state <role> <chId> <chAge> <isGateway> <seqNum>
+//   neighbor <id> <age> <role>
+//   foreign <id> <chId>
+//   member <id>
+//   route <clusterId> <n> <gw1> ... <gwN>
+void LCC::saveSnapshot()
+{
+    std::ofstream out(snapshotFileName, std::ios::out | std::ios::trunc);
+    if (!out.is_open())
+        throw cRuntimeError("LCC snapshot: cannot open '%s' for writing", snapshotFileName.c_str());
+    out.precision(12);
+
+    simtime_t now = simTime();
+    out << "LCCSNAP1 " << myId << "\n";
+
+    cModule *mobilityModule = getContainingNode(this)->getSubmodule("mobility");
+    if (auto mob = dynamic_cast<IMobility *>(mobilityModule)) {
+        const Coord& pos = mob->getCurrentPosition();
+        out << "pos " << pos.x << " " << pos.y << "\n";
+    }
+
+    out << "state " << myRole << " " << myClusterHeadId << " " << (now - chStartTime).dbl() << " "
+        << isGateway << " " << seqNum << "\n";
+    for (auto const& [neighborId, lastSeen] : neighborsLastSeen)
+        out << "neighbor " << neighborId << " " << (now - SimTime::fromRaw(lastSeen)).dbl() << " " << neighborsRoles[neighborId] << "\n";
+    for (auto const& [neighborId, foreignCH] : foreignNeighbors)
+        out << "foreign " << neighborId << " " << foreignCH << "\n";
+    for (int m : myMembers)
+        out << "member " << m << "\n";
+    for (auto const& [clusterId, gateways] : clusterRoutingTable) {
+        out << "route " << clusterId << " " << gateways.size();
+        for (int gw : gateways) out << " " << gw;
+        out << "\n";
+    }
+
+    // k-hop: ağaçtaki yerim + komşuların CH duyuruları (findClusterHeadPath bunlarla çalışır)
+    if (clusterHops > 1) {
+        out << "khop " << myParentId << " " << myChHops << " " << mySubtree.size();
+        for (int id : mySubtree) out << " " << id;
+        out << "\n";
+        for (auto const& [neighborId, advert] : neighborAdverts) {
+            out << "advert " << neighborId << " " << advert.clusterHeadId << " " << advert.chHops << " "
+                << advert.parentId << " " << advert.subtree.size();
+            for (int id : advert.subtree) out << " " << id;
+            out << " " << advert.seenClusters.size();
+            for (int clusterId : advert.seenClusters) out << " " << clusterId;
+            out << "\n";
+        }
+    }
+    LCC_EV(LCC_LOG_INFO) << "SNAPSHOT: durum '" << snapshotFileName << "' dosyasina yazildi" << endl;
+}
+
+void LCC::loadSnapshot()
+{
+    std::ifstream in(snapshotFileName);
+    if (!in.is_open())
+        throw cRuntimeError("LCC snapshot: cannot open '%s'", snapshotFileName.c_str());
+
+    std::string magic;
+    int fileId;
+    if (!(in >> magic >> fileId) || magic != "LCCSNAP1" || fileId != myId)
+        throw cRuntimeError("LCC snapshot: '%s' is not a snapshot of node %d", snapshotFileName.c_str(), myId);
+
+    // Yaşlar t=0'a göre geçmişe taşınır (negatif simtime geçerli)
+    bool hasKHopState = false;
+    std::string key;
+    while (in >> key) {
+        if (key == "pos") {
+            double x, y;
+            in >> x >> y;
+            cModule *mobilityModule = getContainingNode(this)->getSubmodule("mobility");
+            if (mobilityModule && mobilityModule->hasPar("initialX") && mobilityModule->hasPar("initialY")) {
+                if (mobilityModule->hasPar("initFromDisplayString"))
+                    mobilityModule->par("initFromDisplayString").setBoolValue(false);
+                mobilityModule->par("initialX").setDoubleValue(x);
+                mobilityModule->par("initialY").setDoubleValue(y);
+            }
+        }
+        else if (key == "state") {
+            double chAge;
+            in >> myRole >> myClusterHeadId >> chAge >> isGateway >> seqNum;
+            chStartTime = -chAge;
+        }
+        else if (key == "neighbor") {
+            int neighborId, role;
+            double age;
+            in >> neighborId >> age >> role;
+            neighborsLastSeen[neighborId] = SimTime(-age).raw();
+            neighborsRoles[neighborId] = role;
+        }
+        else if (key == "foreign") {
+            int neighborId, foreignCH;
+            in >> neighborId >> foreignCH;
+            foreignNeighbors[neighborId] = foreignCH;
+        }
+        else if (key == "member") {
+            int m;
+            in >> m;
+            myMembers.insert(m);
+        }
+        else if (key == "route") {
+            int clusterId;
+            size_t n;
+            in >> clusterId >> n;
+            std::vector<int>& gateways = clusterRoutingTable[clusterId];
+            for (size_t k = 0; k < n; k++) {
+                int gw;
+                in >> gw;
+                gateways.push_back(gw);
+            }
+        }
+        else if (key == "khop") {
+            size_t n;
+            hasKHopState = true;
+            in >> myParentId >> myChHops >> n;
+            for (size_t k = 0; k < n && in; k++) {
+                int id;
+                in >> id;
+                mySubtree.insert(id);
+            }
+        }
+        else if (key == "advert") {
+            int neighborId;
+            size_t n;
+            in >> neighborId;
+            KHopAdvert& advert = neighborAdverts[neighborId];
+            in >> advert.clusterHeadId >> advert.chHops >> advert.parentId >> n;
+            advert.subtree.resize(in ? n : 0);
+            for (int& id : advert.subtree) in >> id;
+            in >> n;
+            advert.seenClusters.resize(in ? n : 0);
+            for (int& clusterId : advert.seenClusters) in >> clusterId;
+        }
+        else
+            throw cRuntimeError("LCC snapshot: unknown key '%s' in '%s'", key.c_str(), snapshotFileName.c_str());
+
+        if (!in)
+            throw cRuntimeError("LCC snapshot: malformed '%s' line in '%s'", key.c_str(), snapshotFileName.c_str());
+    }
+
+    // k-hop ağaç bilgisi olmadan ilk checkTimeouts üyeleri Undecided'a düşürür
+    if (clusterHops > 1 && !hasKHopState)
+        throw cRuntimeError("LCC snapshot: '%s' has no k-hop state; save it again with clusterHops=%d",
+                            snapshotFileName.c_str(), clusterHops);
+}
+
+void LCC::resetStatistics()
+{
+    Enter_Method_Silent();
+
+    // warmup-period / kararlı durum: kümelenme geçiş dönemi sonuçlara karışmasın.
+    // Bundan önce gönderilen paketler sayılmaz, throughput bu andan itibaren ölçülür
+    warmupPeriod = simTime();
+    numSent = 0;
+    numReceived = 0;
+    totalDelay = 0.0;
+    totalBytesReceived = 0;
+    numBeaconsSent = 0;
+    numRoleChanges = 0;
+    numTxQueueDrops = 0;
+    numInterClusterTx = 0;
+    numHandovers = 0;
+    numHeld = numHoldFlushed = numHoldExpired = numHoldOverflow = 0;
+    for (int k = 0; k < NUM_DROP_REASONS; k++) numDropped[k] = 0;
+    for (int k = 0; k < NUM_HOP_KINDS; k++) { segmentDelay[k] = 0; segmentCount[k] = 0; }
+    numHopTraced = 0;
+    totalHopCount = 0;
+    delaySketch.clear();
+    chLifetimeSketch.clear();
+    clusterSizeSketch.clear();
+    holdWaitSketch.clear();
+    counterSnapshots.clear();
+    receptionBins.clear();
+    statisticsResetTime = simTime();
+}
+
+LCC::CounterSnapshot LCC::currentCounters() const
+{
+    CounterSnapshot c;
+    c.time = simTime();
+    c.sent = numSent;
+    c.received = numReceived;
+    c.totalDelay = totalDelay;
+    c.bytesReceived = totalBytesReceived;
+    c.beaconsSent = numBeaconsSent;
+    c.roleChanges = numRoleChanges;
+    for (int k = 0; k < NUM_DROP_REASONS; k++) c.dropped[k] = numDropped[k];
+    return c;
+}
+
+void LCC::markStatistics()
+{
+    Enter_Method_Silent();
+    counterSnapshots.push_back(currentCounters());
+    receptionBins.resize(counterSnapshots.size() + 1);
+}
+
+void LCC::truncateStatistics(simtime_t truncationTime)
+{
+    Enter_Method_Silent();
+
+    // Kesme noktasındaki (ya da hemen öncesindeki) kopya; yoksa baştan sayılmış
+    CounterSnapshot base = {};
+    for (auto const& snapshot : counterSnapshots) {
+        if (snapshot.time > truncationTime) break;
+        base = snapshot;
+    }
+    CounterSnapshot now = currentCounters();
+
+    // Alınanlar: sadece kesme noktasında ya da sonra gönderilen paketler
+    // (warm-up yolundaki getSendTime() >= warmupPeriod filtresinin karşılığı)
+    ReceptionBin kept;
+    if (truncationTime <= SIMTIME_ZERO) {
+        kept.received = now.received;
+        kept.totalDelay = now.totalDelay;
+        kept.bytesReceived = now.bytesReceived;
+    }
+    else {
+        for (size_t k = 1; k < receptionBins.size(); k++) {
+            if (counterSnapshots[k - 1].time < truncationTime) continue;
+            kept.received += receptionBins[k].received;
+            kept.totalDelay += receptionBins[k].totalDelay;
+            kept.bytesReceived += receptionBins[k].bytesReceived;
+        }
+    }
+
+    // Dağılımlar (sketch), segment ve hold istatistikleri geriye dönük
+    // ayrılamaz: bunlar tespit anında sıfırlanır (statisticsResetTime)
+    resetStatistics();
+
+    numSent = now.sent - base.sent;
+    numReceived = kept.received;
+    totalDelay = kept.totalDelay;
+    totalBytesReceived = kept.bytesReceived;
+    numBeaconsSent = now.beaconsSent - base.beaconsSent;
+    numRoleChanges = now.roleChanges - base.roleChanges;
+    for (int k = 0; k < NUM_DROP_REASONS; k++) numDropped[k] = now.dropped[k] - base.dropped[k];
+
+    // Throughput ve "warm-up'ta gönderilen paket" filtresi kesme noktasından
+    warmupPeriod = truncationTime;
+}
+
+void LCC::recordQuantiles(const char *name, const LccQuantileSketch& sketch)
+{
+    std::string prefix = std::string(name) + ":";
+    recordScalar((prefix + "count").c_str(), (double)sketch.getCount());
+    recordScalar((prefix + "p50").c_str(), sketch.quantile(0.50));
+    recordScalar((prefix + "p95").c_str(), sketch.quantile(0.95));
+    recordScalar((prefix + "p99").c_str(), sketch.quantile(0.99));
+    recordScalar((prefix + "p999").c_str(), sketch.quantile(0.999));
 }
 
 } // namespace
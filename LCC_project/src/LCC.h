@@ -5,8 +5,16 @@
 #include "inet/transportlayer/contract/udp/UdpSocket.h"
 #include "inet/networklayer/common/L3AddressResolver.h"
 #include "inet/applications/base/ApplicationBase.h"
+#include "inet/mobility/contract/IMobility.h"
 // -----------------------------
 #include "LCCMessage_m.h"
+#include "LccTrace.h"
+#include "LccQuantileSketch.h"
+#include "LccTxScheduler.h"
+#include "LccHoldBuffer.h"
+#include "LccTrafficGenerator.h"
+#include "LccNodeSet.h"
+#include "LccScan.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -15,11 +23,43 @@ using namespace omnetpp;
 
 namespace inet {
 
+// ------------------------------------------------------------------
+// LOG SEVİYESİ / HEADLESS DERLEME
+// ------------------------------------------------------------------
+// LCC_EV(level): logLevel parametresi level'dan küçükse argümanlar hiç
+// hesaplanmaz. "make HEADLESS=1" (-DLCC_HEADLESS) ile tüm LCC logları ve
+// updateVisuals derleme zamanında boş koda dönüşür.
+enum LccLogLevel {
+    LCC_LOG_NONE = 0,
+    LCC_LOG_INFO = 1,     // rol / handover / snapshot olayları
+    LCC_LOG_PACKET = 2    // paket başı loglar (hot path)
+};
+
+#ifdef LCC_HEADLESS
+#define LCC_EV(level) if (true) ; else EV
+#else
+#define LCC_EV(level) if (logLevel < (level)) ; else EV
+#endif
+
+// ------------------------------------------------------------------
+// NODE ID KAPASİTESİ
+// ------------------------------------------------------------------
+// "make MAX_NODES=64" / "MAX_NODES=256": node tabloları sabit boyutlu bit
+// dizileri olur (numHosts bu değeri aşarsa initialize hata verir).
+// Varsayılan 0: kapasite başlangıçta numHosts kadar ayrılır.
+#ifndef LCC_MAX_NODES
+#define LCC_MAX_NODES 0
+#endif
+
+typedef LccNodeSet<LCC_MAX_NODES> LccNodeIdSet;
+template<class V> using LccNodeIdMap = LccNodeMap<V, LCC_MAX_NODES>;
+
 class LCC : public ApplicationBase, public UdpSocket::ICallback
 {
   protected:
     // --- Parametreler ---
     simtime_t beaconInterval;
+    simtime_t beaconJitter;
     simtime_t neighborValidityInterval;
     int localPort, destPort;
     bool useMulticast;
@@ -30,21 +70,115 @@ class LCC : public ApplicationBase, public UdpSocket::ICallback
     long numBeaconsSent;     // Gönderdiğim Beacon sayısı (Overhead için)
     int numReceived = 0;
     int numRoleChanges;
+    std::string resultFilePrefix;   // <prefix>_results.csv, _sketches.csv, _segments.csv
+    int logLevel = LCC_LOG_PACKET;  // LccLogLevel
+
+    // --- Adres Çözümleme (node başına önbellek, partition'lar arası erişim yok) ---
+    bool arithmeticAddressPlan = false;    // host[i] = addressBase + i
+    Ipv4Address addressBase;
+    L3Address multicastAddr;
+    std::vector<L3Address> hostAddresses;  // host[i] adresi, ilk kullanımda doldurulur
+
+    // --- Drop Sayaçları (LccDropReason) ---
+    static const int NUM_DROP_REASONS = 4;
+    int hopLimit;
+    long numDropped[NUM_DROP_REASONS] = {};
+
+    // --- Geriye Dönük Warm-up Kesmesi (LccSteadyStateDetector) ---
+    // Detector her gözlem aralığı sonunda sayaçların kopyasını alır; MSER kesme
+    // noktası geçmişte bulununca o andaki kopya çıkarılarak sayaçlar kesme
+    // noktasından itibaren sayılmış olur.
+    struct CounterSnapshot {
+        simtime_t time;
+        long sent, received;
+        double totalDelay;
+        long bytesReceived, beaconsSent, roleChanges;
+        long dropped[NUM_DROP_REASONS];
+    };
+    std::vector<CounterSnapshot> counterSnapshots;
+    CounterSnapshot currentCounters() const;
+    // Alınan paketler gönderim zamanına göre kopya aralıklarına ayrılır: k. kova
+    // [counterSnapshots[k-1].time, counterSnapshots[k].time) içinde gönderilenler.
+    // Kesme noktasından önce gönderilip sonra alınan paketler böylece sayılmaz.
+    struct ReceptionBin {
+        long received = 0;
+        double totalDelay = 0;
+        long bytesReceived = 0;
+    };
+    std::vector<ReceptionBin> receptionBins;
+    // Dağılımlar (sketch), segment ve hold istatistikleri geriye dönük
+    // kesilemez; sıfırlandıkları an ayrı skaler olarak kaydedilir
+    simtime_t statisticsResetTime;
+
+    // --- Dağılım İstatistikleri (p50/p95/p99/p999, sabit bellek) ---
+    LccQuantileSketch delaySketch{1e-6, 1e3, 0.01};        // saniye
+    LccQuantileSketch chLifetimeSketch{1e-3, 1e5, 0.01};   // saniye
+    LccQuantileSketch clusterSizeSketch{1, 1e4, 0.01};     // üye sayısı
+
+    // --- Hop Kaydı (Segment bazlı gecikme) ---
+    static const int NUM_HOP_KINDS = 6;   // LccHopKind
+    int maxHopRecords = 0;                // 0: kapalı
+    double segmentDelay[NUM_HOP_KINDS] = {};
+    long segmentCount[NUM_HOP_KINDS] = {};
+    long numHopTraced = 0;                // hop kaydıyla bana ulaşan paket sayısı
+    long totalHopCount = 0;
     // --- Durum Değişkenleri ---
     int myId;
     int myRole;          // 0: Undecided, 1: Member, 2: CH
     int myClusterHeadId; // Bağlı olduğum lider
     simtime_t chStartTime;
     bool isGateway = false;
+    const char *shownColor = nullptr;   // updateVisuals: son çizilen renk
 
     // --- Ağ Bilgisi ---
-    std::map<int, simtime_t> neighborsLastSeen;
-    std::map<int, int> neighborsRoles;
-    std::map<int, int> foreignNeighbors;
-    std::vector<int> myMembers;
+    LccNodeIdMap<int64_t> neighborsLastSeen;     // simtime raw: LccScan diziyi kopyasız okur
+    LccNodeIdMap<int> neighborsRoles;
+    LccNodeIdMap<uint64_t> neighborBeaconDigest;  // son işlenen beacon içeriği (hızlı yol)
+    LccNodeIdMap<int> foreignNeighbors;
+    LccNodeIdSet myMembers;
+    LccNeighborScan neighborScan;   // checkTimeouts taraması (runLCCLogic de kullanır)
+
+    // --- k-hop Kümeleme (clusterHops > 1) ---
+    // CH duyurusu beacon'larla (clusterHeadId, chHops) k hop'a kadar yayılır;
+    // üyeler k hop içindeki en düşük ID'li CH'ye parent üzerinden bağlanır.
+    struct KHopAdvert {
+        int clusterHeadId = -1;
+        int chHops = 0;
+        int parentId = -1;
+        std::vector<int> subtree;        // komşunun ağaçtaki alt node'ları
+        std::vector<int> seenClusters;   // komşunun (alt ağacıyla) gördüğü yabancı cluster'lar
+    };
+    int clusterHops = 1;                 // 1: klasik 1-hop LCC
+    int myParentId = -1;                 // cluster ağacında CH'ye doğru bir üst hop
+    int myChHops = 0;
+    LccNodeIdSet mySubtree;              // ağaçta altımdaki node'lar (CH: tüm cluster)
+    LccNodeIdMap<KHopAdvert> neighborAdverts;
+
+    // --- Proaktif CH Devri (Backup CH) ---
+    // CH beacon'da yedek CH duyurur; CH kapanırken (handleStopOperation)
+    // CAST_DEPARTURE yayınlar. Üyeler CH kaybında yeniden seçim yerine yedeğe geçer.
+    bool useChHandover = false;
+    int myBackupChId = -1;          // CH: seçtiğim yedek; Member: CH'min duyurduğu yedek
+    bool inOutage = false;          // CH'yi kaybettim, henüz yenisine bağlanmadım
+    simtime_t outageStart;          // CH'den son haber anı (chOutageSignal başlangıcı)
+    long numHandovers = 0;
+
+    // --- Lifecycle (Yeniden Başlama) ---
+    simtime_t restartSolicitWindow;   // 0: solicit yok
+    bool solicitPending = false;      // sıradaki beacon solicit bayraklı gider
+    bool recovering = false;          // yeniden başladım, henüz rol almadım
+    simtime_t restartTime;
+    long numRestarts = 0;
 
     // --- ROUTING ---
-    std::map<int, std::vector<int>> clusterRoutingTable;
+    LccNodeIdMap<std::vector<int>> clusterRoutingTable;
+
+    // --- Backbone (CH + seçili gateway'ler: bağlı baskın küme) ---
+    // CH her komşu cluster için tek gateway seçer; gateway hedef cluster'a tek
+    // giriş node'una iletir. Cluster'lar arası flood O(backbone) ile sınırlı.
+    bool useBackbone = false;
+    LccNodeIdMap<int> backboneGateways;   // CH: hedef cluster -> seçili gateway
+    long numInterClusterTx = 0;           // TX_INTER gönderimleri (flood maliyeti)
     std::map<std::string, simtime_t> seenPackets;
     int seqNum = 0;
 
@@ -52,8 +186,75 @@ class LCC : public ApplicationBase, public UdpSocket::ICallback
     cMessage *beaconTimer;
     cMessage *checkTimeoutTimer;
     cMessage *dataTimer;
+    cMessage *replayTimer;
+    cMessage *txTimer;
+    cMessage *snapshotTimer;
+    cMessage *warmupTimer;
+    cMessage *reportTimer;
+    cMessage *holdTimer;
+    cMessage *stopTimer;            // ayrılış yayını gidene kadar kapanışı bekletir
+    simtime_t stopOperationExtraTime;
+    simtime_t stopOperationTimeout;
     UdpSocket socket;
 
+    // --- Warm-Start Snapshot ---
+    std::string snapshotMode;       // none | save | load
+    std::string snapshotFileName;   // <snapshotFile>-<id>.snap
+    simtime_t warmupPeriod;         // warmup-period: bundan önceki istatistikler sıfırlanır
+
+    // --- Mobilite Tahmini (Link Expiration Time) ---
+    bool useMobilityPrediction = false;
+    double linkRange;               // iletişim menzili (m)
+    simtime_t minLinkLifetime;      // CH / Gateway adayı için gereken kalan link ömrü
+    simtime_t handoverMargin;       // CH linki bu süreden az kalınca yeniden bağlan
+    IMobility *mobility = nullptr;
+    LccNodeIdMap<simtime_t> linkExpiry;   // komşu -> tahmini link kopma zamanı
+
+    // --- Link Kalitesi (SNIR EWMA + Histerezis) ---
+    struct LinkQuality {
+        double snirDb;      // EWMA (dB)
+        bool stable;        // histerezis durumu
+    };
+    bool useLinkQuality = false;
+    double linkQualityAlpha;        // EWMA ağırlığı (yeni örnek)
+    double snirGoodThreshold;       // dB: bunun üstüne çıkan link sağlam sayılır
+    double snirBadThreshold;        // dB: bunun altına inen link marjinal sayılır
+    LccNodeIdMap<LinkQuality> linkQuality;
+
+    // --- Cluster Kapsamlı Yayın + Üye Raporları ---
+    simtime_t memberReportInterval;        // 0: rapor yok
+    bool aggregateReports = true;          // CH raporları tek digest'te toplar
+    LccNodeIdMap<int> pendingReports;   // CH: üye -> komşu sayısı (sonraki digest)
+    LccNodeIdMap<int> clusterDigest;    // Member: son digest'teki cluster görünümü
+    int clusterCastSeq = 0;
+    long numClusterCastsSent = 0;
+    long numClusterCastDiscarded = 0;      // yabancı cluster'ın yayını (erken atılan)
+
+    // --- Trafik Üreteci (sendInterval, payloadSize, hedef seçimi) ---
+    LccTrafficGenerator trafficGenerator;
+
+    // --- Transmit Scheduler (öncelik + token bucket) ---
+    LccTxScheduler txScheduler;
+    long numTxQueueDrops = 0;
+
+    // --- Store-and-Forward (rotası olmayan paketler) ---
+    // routeDataPacket rota bulamazsa paket drop yerine holdBuffer'a girer;
+    // checkTimeouts / beacon sonrası tablolar değişince flushHoldBuffer tekrar dener.
+    static const int ROUTE_SENT = -1;     // routeDataPacket: paket gönderildi
+    LccHoldBuffer holdBuffer;
+    simtime_t holdTime;
+    LccQuantileSketch holdWaitSketch{1e-6, 1e3, 0.01};   // saniye
+    long numHeld = 0;            // buffer'a giren
+    long numHoldFlushed = 0;     // rota bulup çıkan
+    long numHoldExpired = 0;     // deadline'da drop
+    long numHoldOverflow = 0;    // buffer dolu (politikayla atılan)
+
+    // --- Trace (Record / Replay) ---
+    bool traceRecording = false;
+    bool traceReplaying = false;
+    LccTraceWriter traceWriter;
+    LccTraceReader traceReader;
+
     // --- Sinyaller ---
     simsignal_t chChangeSignal;
     simsignal_t chLifetimeSignal;
@@ -63,11 +264,27 @@ class LCC : public ApplicationBase, public UdpSocket::ICallback
     simsignal_t pdrSignal;
     simsignal_t dataSentSignal;
     simsignal_t dataReceivedSignal;
+    simsignal_t hopCountSignal;
+    simsignal_t dataDroppedSignal;
+    simsignal_t txQueueLengthSignal;
+    simsignal_t txQueueWaitSignal;
+    simsignal_t beaconQueueWaitSignal;
+    simsignal_t roleChangeSignal;
+    simsignal_t chOutageSignal;
+    simsignal_t restartRecoverySignal;
+    simsignal_t holdBufferLengthSignal;
+    simsignal_t holdWaitSignal;
 
   public:
     LCC();
     virtual ~LCC();
 
+    // Warm-up sonu: sonuç sayaçlarını sıfırlar (warmupTimer)
+    void resetStatistics();
+    // LccSteadyStateDetector: gözlem sonu kopyası / geçmişteki noktadan kesme
+    void markStatistics();
+    void truncateStatistics(simtime_t truncationTime);
+
   protected:
     virtual void initialize(int stage) override;
     virtual void handleMessageWhenUp(cMessage *msg) override;
@@ -77,20 +294,71 @@ class LCC : public ApplicationBase, public UdpSocket::ICallback
     virtual void handleStartOperation(LifecycleOperation *operation) override;
     virtual void handleStopOperation(LifecycleOperation *operation) override;
     virtual void handleCrashOperation(LifecycleOperation *operation) override;
+    void cancelTimers();
+    void resetState();
 
     // Logic
     void sendBeacon();
     void sendDataPacket();
     void checkTimeouts();
     void runLCCLogic();
+    void runKHopLogic();
+    bool findClusterHeadPath(int chId, int& via, int& hops) const;
+    bool isChild(const KHopAdvert& advert) const { return advert.parentId == myId && advert.clusterHeadId == myClusterHeadId; }
+    void updateSubtree();
+    int upstreamHop() const { return clusterHops > 1 ? myParentId : myClusterHeadId; }
+    int downstreamHop(int destId) const;
+    int gatewayChild(int targetClusterId) const;
+    bool forwardDown(const Ptr<const LccData>& dataPkt);
     void updateVisuals();
+    const L3Address& hostAddress(int id);
+    simtime_t remainingLinkLifetime(int neighborId) const;
+    bool isLongLivedLink(int neighborId) const;
+    void updateLinkQuality(int neighborId, double snirDb);
+    bool isStableLink(int neighborId) const;
+    bool isUsableLink(int neighborId) const { return isLongLivedLink(neighborId) && isStableLink(neighborId); }
+    bool proactiveReaffiliation();
+    int selectBackupCh() const;
+    bool handoverToBackup();
+    void beginOutage(simtime_t since);
+    void noteAffiliation();
+    void forgetNeighbor(int neighborId);
+    int selectGateway(const std::vector<int>& gateways, const std::vector<int>& usedGateways);
+    void pruneGateway(int gatewayId, const LccBeacon *beacon);
+    void updateBackbone();
+    int backboneEntry(int targetClusterId) const;
+    void replayNextArrival();
+    void recordQuantiles(const char *name, const LccQuantileSketch& sketch);
+    void recordSegmentStats();
+    void saveSnapshot();
+    void loadSnapshot();
 
     // Socket & Packet Processing
     virtual void socketDataArrived(UdpSocket *socket, Packet *packet) override;
     virtual void socketErrorArrived(UdpSocket *socket, Indication *indication) override { delete indication; }
     virtual void socketClosed(UdpSocket *socket) override {}
 
+    void processBeacon(Packet *packet, const Ptr<const LccBeacon>& beacon);
+    uint64_t beaconDigest(const LccBeacon& beacon) const;
     void processDataPacket(Packet *packet, const Ptr<const LccData>& dataPkt);
+    int routeDataPacket(const std::string& pktName, const Ptr<const LccData>& dataPkt);
+    int dispatchOwnData(const Ptr<LccData>& data);
+    void holdOrDrop(int reason, const std::string& pktName, const Ptr<const LccData>& dataPkt, bool originated);
+    void flushHoldBuffer();
+    void expireHeldPackets();
+    void scheduleHoldTimer();
+    void clusterBroadcast(const Ptr<LccClusterCast>& cast, bool immediate = false);
+    void sendMemberReport();
+    void flushReportDigest();
+    void processClusterCast(const Ptr<const LccClusterCast>& cast);
+    void processMemberReport(const Ptr<const LccReport>& report);
+    void sendPacket(Packet *packet, const L3Address& destAddr, int txClass);
+    void serviceTxQueue();
+    void transmit(Packet *packet, const L3Address& destAddr);
+    void countDrop(int reason);
+    Ptr<LccData> forwardCopy(const Ptr<const LccData>& dataPkt, int hopKind);
+    void appendHop(const Ptr<LccData>& data, int hopKind);
+    void recordHopSegments(const Ptr<const LccData>& dataPkt);
 };
 
 } // namespace inet
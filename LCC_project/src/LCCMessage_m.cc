@@ -1,1081 +0,0 @@
-//
-// Generated file, do not edit! Created by opp_msgtool 6.2 from src/LCCMessage.msg.
-//
-
-// Disable warnings about unused variables, empty switch stmts, etc:
-#ifdef _MSC_VER
-#  pragma warning(disable:4101)
-#  pragma warning(disable:4065)
-#endif
-
-#if defined(__clang__)
-#  pragma clang diagnostic ignored "-Wshadow"
-#  pragma clang diagnostic ignored "-Wconversion"
-#  pragma clang diagnostic ignored "-Wunused-parameter"
-#  pragma clang diagnostic ignored "-Wc++98-compat"
-#  pragma clang diagnostic ignored "-Wunreachable-code-break"
-#  pragma clang diagnostic ignored "-Wold-style-cast"
-#elif defined(__GNUC__)
-#  pragma GCC diagnostic ignored "-Wshadow"
-#  pragma GCC diagnostic ignored "-Wconversion"
-#  pragma GCC diagnostic ignored "-Wunused-parameter"
-#  pragma GCC diagnostic ignored "-Wold-style-cast"
-#  pragma GCC diagnostic ignored "-Wsuggest-attribute=noreturn"
-#  pragma GCC diagnostic ignored "-Wfloat-conversion"
-#endif
-
-#include <iostream>
-#include <sstream>
-#include <memory>
-#include <type_traits>
-#include "LCCMessage_m.h"
-
-namespace omnetpp {
-
-// Template pack/unpack rules. They are declared *after* a1l type-specific pack functions for multiple reasons.
-// They are in the omnetpp namespace, to allow them to be found by argument-dependent lookup via the cCommBuffer argument
-
-// Packing/unpacking an std::vector
-template<typename T, typename A>
-void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::vector<T,A>& v)
-{
-    int n = v.size();
-    doParsimPacking(buffer, n);
-    for (int i = 0; i < n; i++)
-        doParsimPacking(buffer, v[i]);
-}
-
-template<typename T, typename A>
-void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::vector<T,A>& v)
-{
-    int n;
-    doParsimUnpacking(buffer, n);
-    v.resize(n);
-    for (int i = 0; i < n; i++)
-        doParsimUnpacking(buffer, v[i]);
-}
-
-// Packing/unpacking an std::list
-template<typename T, typename A>
-void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::list<T,A>& l)
-{
-    doParsimPacking(buffer, (int)l.size());
-    for (typename std::list<T,A>::const_iterator it = l.begin(); it != l.end(); ++it)
-        doParsimPacking(buffer, (T&)*it);
-}
-
-template<typename T, typename A>
-void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::list<T,A>& l)
-{
-    int n;
-    doParsimUnpacking(buffer, n);
-    for (int i = 0; i < n; i++) {
-        l.push_back(T());
-        doParsimUnpacking(buffer, l.back());
-    }
-}
-
-// Packing/unpacking an std::set
-template<typename T, typename Tr, typename A>
-void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::set<T,Tr,A>& s)
-{
-    doParsimPacking(buffer, (int)s.size());
-    for (typename std::set<T,Tr,A>::const_iterator it = s.begin(); it != s.end(); ++it)
-        doParsimPacking(buffer, *it);
-}
-
-template<typename T, typename Tr, typename A>
-void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::set<T,Tr,A>& s)
-{
-    int n;
-    doParsimUnpacking(buffer, n);
-    for (int i = 0; i < n; i++) {
-        T x;
-        doParsimUnpacking(buffer, x);
-        s.insert(x);
-    }
-}
-
-// Packing/unpacking an std::map
-template<typename K, typename V, typename Tr, typename A>
-void doParsimPacking(omnetpp::cCommBuffer *buffer, const std::map<K,V,Tr,A>& m)
-{
-    doParsimPacking(buffer, (int)m.size());
-    for (typename std::map<K,V,Tr,A>::const_iterator it = m.begin(); it != m.end(); ++it) {
-        doParsimPacking(buffer, it->first);
-        doParsimPacking(buffer, it->second);
-    }
-}
-
-template<typename K, typename V, typename Tr, typename A>
-void doParsimUnpacking(omnetpp::cCommBuffer *buffer, std::map<K,V,Tr,A>& m)
-{
-    int n;
-    doParsimUnpacking(buffer, n);
-    for (int i = 0; i < n; i++) {
-        K k; V v;
-        doParsimUnpacking(buffer, k);
-        doParsimUnpacking(buffer, v);
-        m[k] = v;
-    }
-}
-
-// Default pack/unpack function for arrays
-template<typename T>
-void doParsimArrayPacking(omnetpp::cCommBuffer *b, const T *t, int n)
-{
-    for (int i = 0; i < n; i++)
-        doParsimPacking(b, t[i]);
-}
-
-template<typename T>
-void doParsimArrayUnpacking(omnetpp::cCommBuffer *b, T *t, int n)
-{
-    for (int i = 0; i < n; i++)
-        doParsimUnpacking(b, t[i]);
-}
-
-// Default rule to prevent compiler from choosing base class' doParsimPacking() function
-template<typename T>
-void doParsimPacking(omnetpp::cCommBuffer *, const T& t)
-{
-    throw omnetpp::cRuntimeError("Parsim error: No doParsimPacking() function for type %s", omnetpp::opp_typename(typeid(t)));
-}
-
-template<typename T>
-void doParsimUnpacking(omnetpp::cCommBuffer *, T& t)
-{
-    throw omnetpp::cRuntimeError("Parsim error: No doParsimUnpacking() function for type %s", omnetpp::opp_typename(typeid(t)));
-}
-
-}  // namespace omnetpp
-
-namespace inet {
-
-Register_Enum(inet::LccRole, (inet::LccRole::UNDECIDED, inet::LccRole::CLUSTER_MEMBER, inet::LccRole::CLUSTER_HEAD));
-
-Register_Class(LccBeacon)
-
-LccBeacon::LccBeacon() : ::inet::FieldsChunk()
-{
-}
-
-LccBeacon::LccBeacon(const LccBeacon& other) : ::inet::FieldsChunk(other)
-{
-    copy(other);
-}
-
-LccBeacon::~LccBeacon()
-{
-    delete [] this->seenClusterIds;
-}
-
-LccBeacon& LccBeacon::operator=(const LccBeacon& other)
-{
-    if (this == &other) return *this;
-    ::inet::FieldsChunk::operator=(other);
-    copy(other);
-    return *this;
-}
-
-void LccBeacon::copy(const LccBeacon& other)
-{
-    this->srcId = other.srcId;
-    this->role = other.role;
-    this->clusterHeadId = other.clusterHeadId;
-    delete [] this->seenClusterIds;
-    this->seenClusterIds = (other.seenClusterIds_arraysize==0) ? nullptr : new int[other.seenClusterIds_arraysize];
-    seenClusterIds_arraysize = other.seenClusterIds_arraysize;
-    for (size_t i = 0; i < seenClusterIds_arraysize; i++) {
-        this->seenClusterIds[i] = other.seenClusterIds[i];
-    }
-}
-
-void LccBeacon::parsimPack(omnetpp::cCommBuffer *b) const
-{
-    ::inet::FieldsChunk::parsimPack(b);
-    doParsimPacking(b,this->srcId);
-    doParsimPacking(b,this->role);
-    doParsimPacking(b,this->clusterHeadId);
-    b->pack(seenClusterIds_arraysize);
-    doParsimArrayPacking(b,this->seenClusterIds,seenClusterIds_arraysize);
-}
-
-void LccBeacon::parsimUnpack(omnetpp::cCommBuffer *b)
-{
-    ::inet::FieldsChunk::parsimUnpack(b);
-    doParsimUnpacking(b,this->srcId);
-    doParsimUnpacking(b,this->role);
-    doParsimUnpacking(b,this->clusterHeadId);
-    delete [] this->seenClusterIds;
-    b->unpack(seenClusterIds_arraysize);
-    if (seenClusterIds_arraysize == 0) {
-        this->seenClusterIds = nullptr;
-    } else {
-        this->seenClusterIds = new int[seenClusterIds_arraysize];
-        doParsimArrayUnpacking(b,this->seenClusterIds,seenClusterIds_arraysize);
-    }
-}
-
-int LccBeacon::getSrcId() const
-{
-    return this->srcId;
-}
-
-void LccBeacon::setSrcId(int srcId)
-{
-    handleChange();
-    this->srcId = srcId;
-}
-
-int LccBeacon::getRole() const
-{
-    return this->role;
-}
-
-void LccBeacon::setRole(int role)
-{
-    handleChange();
-    this->role = role;
-}
-
-int LccBeacon::getClusterHeadId() const
-{
-    return this->clusterHeadId;
-}
-
-void LccBeacon::setClusterHeadId(int clusterHeadId)
-{
-    handleChange();
-    this->clusterHeadId = clusterHeadId;
-}
-
-size_t LccBeacon::getSeenClusterIdsArraySize() const
-{
-    return seenClusterIds_arraysize;
-}
-
-int LccBeacon::getSeenClusterIds(size_t k) const
-{
-    if (k >= seenClusterIds_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seenClusterIds_arraysize, (unsigned long)k);
-    return this->seenClusterIds[k];
-}
-
-void LccBeacon::setSeenClusterIdsArraySize(size_t newSize)
-{
-    handleChange();
-    int *seenClusterIds2 = (newSize==0) ? nullptr : new int[newSize];
-    size_t minSize = seenClusterIds_arraysize < newSize ? seenClusterIds_arraysize : newSize;
-    for (size_t i = 0; i < minSize; i++)
-        seenClusterIds2[i] = this->seenClusterIds[i];
-    for (size_t i = minSize; i < newSize; i++)
-        seenClusterIds2[i] = 0;
-    delete [] this->seenClusterIds;
-    this->seenClusterIds = seenClusterIds2;
-    seenClusterIds_arraysize = newSize;
-}
-
-void LccBeacon::setSeenClusterIds(size_t k, int seenClusterIds)
-{
-    if (k >= seenClusterIds_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seenClusterIds_arraysize, (unsigned long)k);
-    handleChange();
-    this->seenClusterIds[k] = seenClusterIds;
-}
-
-void LccBeacon::insertSeenClusterIds(size_t k, int seenClusterIds)
-{
-    if (k > seenClusterIds_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seenClusterIds_arraysize, (unsigned long)k);
-    handleChange();
-    size_t newSize = seenClusterIds_arraysize + 1;
-    int *seenClusterIds2 = new int[newSize];
-    size_t i;
-    for (i = 0; i < k; i++)
-        seenClusterIds2[i] = this->seenClusterIds[i];
-    seenClusterIds2[k] = seenClusterIds;
-    for (i = k + 1; i < newSize; i++)
-        seenClusterIds2[i] = this->seenClusterIds[i-1];
-    delete [] this->seenClusterIds;
-    this->seenClusterIds = seenClusterIds2;
-    seenClusterIds_arraysize = newSize;
-}
-
-void LccBeacon::appendSeenClusterIds(int seenClusterIds)
-{
-    insertSeenClusterIds(seenClusterIds_arraysize, seenClusterIds);
-}
-
-void LccBeacon::eraseSeenClusterIds(size_t k)
-{
-    if (k >= seenClusterIds_arraysize) throw omnetpp::cRuntimeError("Array of size %lu indexed by %lu", (unsigned long)seenClusterIds_arraysize, (unsigned long)k);
-    handleChange();
-    size_t newSize = seenClusterIds_arraysize - 1;
-    int *seenClusterIds2 = (newSize == 0) ? nullptr : new int[newSize];
-    size_t i;
-    for (i = 0; i < k; i++)
-        seenClusterIds2[i] = this->seenClusterIds[i];
-    for (i = k; i < newSize; i++)
-        seenClusterIds2[i] = this->seenClusterIds[i+1];
-    delete [] this->seenClusterIds;
-    this->seenClusterIds = seenClusterIds2;
-    seenClusterIds_arraysize = newSize;
-}
-
-class LccBeaconDescriptor : public omnetpp::cClassDescriptor
-{
-  private:
-    mutable const char **propertyNames;
-    enum FieldConstants {
-        FIELD_srcId,
-        FIELD_role,
-        FIELD_clusterHeadId,
-        FIELD_seenClusterIds,
-    };
-  public:
-    LccBeaconDescriptor();
-    virtual ~LccBeaconDescriptor();
-
-    virtual bool doesSupport(omnetpp::cObject *obj) const override;
-    virtual const char **getPropertyNames() const override;
-    virtual const char *getProperty(const char *propertyName) const override;
-    virtual int getFieldCount() const override;
-    virtual const char *getFieldName(int field) const override;
-    virtual int findField(const char *fieldName) const override;
-    virtual unsigned int getFieldTypeFlags(int field) const override;
-    virtual const char *getFieldTypeString(int field) const override;
-    virtual const char **getFieldPropertyNames(int field) const override;
-    virtual const char *getFieldProperty(int field, const char *propertyName) const override;
-    virtual int getFieldArraySize(omnetpp::any_ptr object, int field) const override;
-    virtual void setFieldArraySize(omnetpp::any_ptr object, int field, int size) const override;
-
-    virtual const char *getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const override;
-    virtual std::string getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const override;
-    virtual omnetpp::cValue getFieldValue(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const override;
-
-    virtual const char *getFieldStructName(int field) const override;
-    virtual omnetpp::any_ptr getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const override;
-};
-
-Register_ClassDescriptor(LccBeaconDescriptor)
-
-LccBeaconDescriptor::LccBeaconDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(inet::LccBeacon)), "inet::FieldsChunk")
-{
-    propertyNames = nullptr;
-}
-
-LccBeaconDescriptor::~LccBeaconDescriptor()
-{
-    delete[] propertyNames;
-}
-
-bool LccBeaconDescriptor::doesSupport(omnetpp::cObject *obj) const
-{
-    return dynamic_cast<LccBeacon *>(obj)!=nullptr;
-}
-
-const char **LccBeaconDescriptor::getPropertyNames() const
-{
-    if (!propertyNames) {
-        static const char *names[] = {  nullptr };
-        omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-        const char **baseNames = base ? base->getPropertyNames() : nullptr;
-        propertyNames = mergeLists(baseNames, names);
-    }
-    return propertyNames;
-}
-
-const char *LccBeaconDescriptor::getProperty(const char *propertyName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? base->getProperty(propertyName) : nullptr;
-}
-
-int LccBeaconDescriptor::getFieldCount() const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? 4+base->getFieldCount() : 4;
-}
-
-unsigned int LccBeaconDescriptor::getFieldTypeFlags(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldTypeFlags(field);
-        field -= base->getFieldCount();
-    }
-    static unsigned int fieldTypeFlags[] = {
-        FD_ISEDITABLE,    // FIELD_srcId
-        FD_ISEDITABLE,    // FIELD_role
-        FD_ISEDITABLE,    // FIELD_clusterHeadId
-        FD_ISARRAY | FD_ISEDITABLE | FD_ISRESIZABLE,    // FIELD_seenClusterIds
-    };
-    return (field >= 0 && field < 4) ? fieldTypeFlags[field] : 0;
-}
-
-const char *LccBeaconDescriptor::getFieldName(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldName(field);
-        field -= base->getFieldCount();
-    }
-    static const char *fieldNames[] = {
-        "srcId",
-        "role",
-        "clusterHeadId",
-        "seenClusterIds",
-    };
-    return (field >= 0 && field < 4) ? fieldNames[field] : nullptr;
-}
-
-int LccBeaconDescriptor::findField(const char *fieldName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    int baseIndex = base ? base->getFieldCount() : 0;
-    if (strcmp(fieldName, "srcId") == 0) return baseIndex + 0;
-    if (strcmp(fieldName, "role") == 0) return baseIndex + 1;
-    if (strcmp(fieldName, "clusterHeadId") == 0) return baseIndex + 2;
-    if (strcmp(fieldName, "seenClusterIds") == 0) return baseIndex + 3;
-    return base ? base->findField(fieldName) : -1;
-}
-
-const char *LccBeaconDescriptor::getFieldTypeString(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldTypeString(field);
-        field -= base->getFieldCount();
-    }
-    static const char *fieldTypeStrings[] = {
-        "int",    // FIELD_srcId
-        "int",    // FIELD_role
-        "int",    // FIELD_clusterHeadId
-        "int",    // FIELD_seenClusterIds
-    };
-    return (field >= 0 && field < 4) ? fieldTypeStrings[field] : nullptr;
-}
-
-const char **LccBeaconDescriptor::getFieldPropertyNames(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldPropertyNames(field);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-const char *LccBeaconDescriptor::getFieldProperty(int field, const char *propertyName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldProperty(field, propertyName);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-int LccBeaconDescriptor::getFieldArraySize(omnetpp::any_ptr object, int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldArraySize(object, field);
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_seenClusterIds: return pp->getSeenClusterIdsArraySize();
-        default: return 0;
-    }
-}
-
-void LccBeaconDescriptor::setFieldArraySize(omnetpp::any_ptr object, int field, int size) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldArraySize(object, field, size);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_seenClusterIds: pp->setSeenClusterIdsArraySize(size); break;
-        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'LccBeacon'", field);
-    }
-}
-
-const char *LccBeaconDescriptor::getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldDynamicTypeString(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-std::string LccBeaconDescriptor::getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldValueAsString(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: return long2string(pp->getSrcId());
-        case FIELD_role: return long2string(pp->getRole());
-        case FIELD_clusterHeadId: return long2string(pp->getClusterHeadId());
-        case FIELD_seenClusterIds: return long2string(pp->getSeenClusterIds(i));
-        default: return "";
-    }
-}
-
-void LccBeaconDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldValueAsString(object, field, i, value);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: pp->setSrcId(string2long(value)); break;
-        case FIELD_role: pp->setRole(string2long(value)); break;
-        case FIELD_clusterHeadId: pp->setClusterHeadId(string2long(value)); break;
-        case FIELD_seenClusterIds: pp->setSeenClusterIds(i,string2long(value)); break;
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccBeacon'", field);
-    }
-}
-
-omnetpp::cValue LccBeaconDescriptor::getFieldValue(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldValue(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: return pp->getSrcId();
-        case FIELD_role: return pp->getRole();
-        case FIELD_clusterHeadId: return pp->getClusterHeadId();
-        case FIELD_seenClusterIds: return pp->getSeenClusterIds(i);
-        default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'LccBeacon' as cValue -- field index out of range?", field);
-    }
-}
-
-void LccBeaconDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldValue(object, field, i, value);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: pp->setSrcId(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        case FIELD_role: pp->setRole(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        case FIELD_clusterHeadId: pp->setClusterHeadId(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        case FIELD_seenClusterIds: pp->setSeenClusterIds(i,omnetpp::checked_int_cast<int>(value.intValue())); break;
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccBeacon'", field);
-    }
-}
-
-const char *LccBeaconDescriptor::getFieldStructName(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldStructName(field);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    };
-}
-
-omnetpp::any_ptr LccBeaconDescriptor::getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldStructValuePointer(object, field, i);
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        default: return omnetpp::any_ptr(nullptr);
-    }
-}
-
-void LccBeaconDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldStructValuePointer(object, field, i, ptr);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccBeacon *pp = omnetpp::fromAnyPtr<LccBeacon>(object); (void)pp;
-    switch (field) {
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccBeacon'", field);
-    }
-}
-
-Register_Class(LccData)
-
-LccData::LccData() : ::inet::FieldsChunk()
-{
-}
-
-LccData::LccData(const LccData& other) : ::inet::FieldsChunk(other)
-{
-    copy(other);
-}
-
-LccData::~LccData()
-{
-}
-
-LccData& LccData::operator=(const LccData& other)
-{
-    if (this == &other) return *this;
-    ::inet::FieldsChunk::operator=(other);
-    copy(other);
-    return *this;
-}
-
-void LccData::copy(const LccData& other)
-{
-    this->srcId = other.srcId;
-    this->destId = other.destId;
-    this->sendTime = other.sendTime;
-    this->seqNo = other.seqNo;
-}
-
-void LccData::parsimPack(omnetpp::cCommBuffer *b) const
-{
-    ::inet::FieldsChunk::parsimPack(b);
-    doParsimPacking(b,this->srcId);
-    doParsimPacking(b,this->destId);
-    doParsimPacking(b,this->sendTime);
-    doParsimPacking(b,this->seqNo);
-}
-
-void LccData::parsimUnpack(omnetpp::cCommBuffer *b)
-{
-    ::inet::FieldsChunk::parsimUnpack(b);
-    doParsimUnpacking(b,this->srcId);
-    doParsimUnpacking(b,this->destId);
-    doParsimUnpacking(b,this->sendTime);
-    doParsimUnpacking(b,this->seqNo);
-}
-
-int LccData::getSrcId() const
-{
-    return this->srcId;
-}
-
-void LccData::setSrcId(int srcId)
-{
-    handleChange();
-    this->srcId = srcId;
-}
-
-int LccData::getDestId() const
-{
-    return this->destId;
-}
-
-void LccData::setDestId(int destId)
-{
-    handleChange();
-    this->destId = destId;
-}
-
-::omnetpp::simtime_t LccData::getSendTime() const
-{
-    return this->sendTime;
-}
-
-void LccData::setSendTime(::omnetpp::simtime_t sendTime)
-{
-    handleChange();
-    this->sendTime = sendTime;
-}
-
-int LccData::getSeqNo() const
-{
-    return this->seqNo;
-}
-
-void LccData::setSeqNo(int seqNo)
-{
-    handleChange();
-    this->seqNo = seqNo;
-}
-
-class LccDataDescriptor : public omnetpp::cClassDescriptor
-{
-  private:
-    mutable const char **propertyNames;
-    enum FieldConstants {
-        FIELD_srcId,
-        FIELD_destId,
-        FIELD_sendTime,
-        FIELD_seqNo,
-    };
-  public:
-    LccDataDescriptor();
-    virtual ~LccDataDescriptor();
-
-    virtual bool doesSupport(omnetpp::cObject *obj) const override;
-    virtual const char **getPropertyNames() const override;
-    virtual const char *getProperty(const char *propertyName) const override;
-    virtual int getFieldCount() const override;
-    virtual const char *getFieldName(int field) const override;
-    virtual int findField(const char *fieldName) const override;
-    virtual unsigned int getFieldTypeFlags(int field) const override;
-    virtual const char *getFieldTypeString(int field) const override;
-    virtual const char **getFieldPropertyNames(int field) const override;
-    virtual const char *getFieldProperty(int field, const char *propertyName) const override;
-    virtual int getFieldArraySize(omnetpp::any_ptr object, int field) const override;
-    virtual void setFieldArraySize(omnetpp::any_ptr object, int field, int size) const override;
-
-    virtual const char *getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const override;
-    virtual std::string getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const override;
-    virtual omnetpp::cValue getFieldValue(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const override;
-
-    virtual const char *getFieldStructName(int field) const override;
-    virtual omnetpp::any_ptr getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const override;
-    virtual void setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const override;
-};
-
-Register_ClassDescriptor(LccDataDescriptor)
-
-LccDataDescriptor::LccDataDescriptor() : omnetpp::cClassDescriptor(omnetpp::opp_typename(typeid(inet::LccData)), "inet::FieldsChunk")
-{
-    propertyNames = nullptr;
-}
-
-LccDataDescriptor::~LccDataDescriptor()
-{
-    delete[] propertyNames;
-}
-
-bool LccDataDescriptor::doesSupport(omnetpp::cObject *obj) const
-{
-    return dynamic_cast<LccData *>(obj)!=nullptr;
-}
-
-const char **LccDataDescriptor::getPropertyNames() const
-{
-    if (!propertyNames) {
-        static const char *names[] = {  nullptr };
-        omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-        const char **baseNames = base ? base->getPropertyNames() : nullptr;
-        propertyNames = mergeLists(baseNames, names);
-    }
-    return propertyNames;
-}
-
-const char *LccDataDescriptor::getProperty(const char *propertyName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? base->getProperty(propertyName) : nullptr;
-}
-
-int LccDataDescriptor::getFieldCount() const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    return base ? 4+base->getFieldCount() : 4;
-}
-
-unsigned int LccDataDescriptor::getFieldTypeFlags(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldTypeFlags(field);
-        field -= base->getFieldCount();
-    }
-    static unsigned int fieldTypeFlags[] = {
-        FD_ISEDITABLE,    // FIELD_srcId
-        FD_ISEDITABLE,    // FIELD_destId
-        FD_ISEDITABLE,    // FIELD_sendTime
-        FD_ISEDITABLE,    // FIELD_seqNo
-    };
-    return (field >= 0 && field < 4) ? fieldTypeFlags[field] : 0;
-}
-
-const char *LccDataDescriptor::getFieldName(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldName(field);
-        field -= base->getFieldCount();
-    }
-    static const char *fieldNames[] = {
-        "srcId",
-        "destId",
-        "sendTime",
-        "seqNo",
-    };
-    return (field >= 0 && field < 4) ? fieldNames[field] : nullptr;
-}
-
-int LccDataDescriptor::findField(const char *fieldName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    int baseIndex = base ? base->getFieldCount() : 0;
-    if (strcmp(fieldName, "srcId") == 0) return baseIndex + 0;
-    if (strcmp(fieldName, "destId") == 0) return baseIndex + 1;
-    if (strcmp(fieldName, "sendTime") == 0) return baseIndex + 2;
-    if (strcmp(fieldName, "seqNo") == 0) return baseIndex + 3;
-    return base ? base->findField(fieldName) : -1;
-}
-
-const char *LccDataDescriptor::getFieldTypeString(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldTypeString(field);
-        field -= base->getFieldCount();
-    }
-    static const char *fieldTypeStrings[] = {
-        "int",    // FIELD_srcId
-        "int",    // FIELD_destId
-        "omnetpp::simtime_t",    // FIELD_sendTime
-        "int",    // FIELD_seqNo
-    };
-    return (field >= 0 && field < 4) ? fieldTypeStrings[field] : nullptr;
-}
-
-const char **LccDataDescriptor::getFieldPropertyNames(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldPropertyNames(field);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-const char *LccDataDescriptor::getFieldProperty(int field, const char *propertyName) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldProperty(field, propertyName);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-int LccDataDescriptor::getFieldArraySize(omnetpp::any_ptr object, int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldArraySize(object, field);
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        default: return 0;
-    }
-}
-
-void LccDataDescriptor::setFieldArraySize(omnetpp::any_ptr object, int field, int size) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldArraySize(object, field, size);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        default: throw omnetpp::cRuntimeError("Cannot set array size of field %d of class 'LccData'", field);
-    }
-}
-
-const char *LccDataDescriptor::getFieldDynamicTypeString(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldDynamicTypeString(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        default: return nullptr;
-    }
-}
-
-std::string LccDataDescriptor::getFieldValueAsString(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldValueAsString(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: return long2string(pp->getSrcId());
-        case FIELD_destId: return long2string(pp->getDestId());
-        case FIELD_sendTime: return simtime2string(pp->getSendTime());
-        case FIELD_seqNo: return long2string(pp->getSeqNo());
-        default: return "";
-    }
-}
-
-void LccDataDescriptor::setFieldValueAsString(omnetpp::any_ptr object, int field, int i, const char *value) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldValueAsString(object, field, i, value);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: pp->setSrcId(string2long(value)); break;
-        case FIELD_destId: pp->setDestId(string2long(value)); break;
-        case FIELD_sendTime: pp->setSendTime(string2simtime(value)); break;
-        case FIELD_seqNo: pp->setSeqNo(string2long(value)); break;
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccData'", field);
-    }
-}
-
-omnetpp::cValue LccDataDescriptor::getFieldValue(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldValue(object,field,i);
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: return pp->getSrcId();
-        case FIELD_destId: return pp->getDestId();
-        case FIELD_sendTime: return pp->getSendTime().dbl();
-        case FIELD_seqNo: return pp->getSeqNo();
-        default: throw omnetpp::cRuntimeError("Cannot return field %d of class 'LccData' as cValue -- field index out of range?", field);
-    }
-}
-
-void LccDataDescriptor::setFieldValue(omnetpp::any_ptr object, int field, int i, const omnetpp::cValue& value) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldValue(object, field, i, value);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        case FIELD_srcId: pp->setSrcId(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        case FIELD_destId: pp->setDestId(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        case FIELD_sendTime: pp->setSendTime(value.doubleValue()); break;
-        case FIELD_seqNo: pp->setSeqNo(omnetpp::checked_int_cast<int>(value.intValue())); break;
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccData'", field);
-    }
-}
-
-const char *LccDataDescriptor::getFieldStructName(int field) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldStructName(field);
-        field -= base->getFieldCount();
-    }
-    switch (field) {
-        default: return nullptr;
-    };
-}
-
-omnetpp::any_ptr LccDataDescriptor::getFieldStructValuePointer(omnetpp::any_ptr object, int field, int i) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount())
-            return base->getFieldStructValuePointer(object, field, i);
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        default: return omnetpp::any_ptr(nullptr);
-    }
-}
-
-void LccDataDescriptor::setFieldStructValuePointer(omnetpp::any_ptr object, int field, int i, omnetpp::any_ptr ptr) const
-{
-    omnetpp::cClassDescriptor *base = getBaseClassDescriptor();
-    if (base) {
-        if (field < base->getFieldCount()){
-            base->setFieldStructValuePointer(object, field, i, ptr);
-            return;
-        }
-        field -= base->getFieldCount();
-    }
-    LccData *pp = omnetpp::fromAnyPtr<LccData>(object); (void)pp;
-    switch (field) {
-        default: throw omnetpp::cRuntimeError("Cannot set field %d of class 'LccData'", field);
-    }
-}
-
-}  // namespace inet
-
-namespace omnetpp {
-
-}  // namespace omnetpp
-
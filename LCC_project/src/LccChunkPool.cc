@@ -0,0 +1,77 @@
+#include "LccChunkPool.h"
+#include <algorithm>
+#include <new>
+
+namespace inet {
+
+LccChunkPool::FreeBlock *LccChunkPool::freeLists[MAX_POOLED_SIZE / GRANULE] = {};
+bool LccChunkPool::enabled = true;
+uint64_t LccChunkPool::numHits = 0;
+uint64_t LccChunkPool::numMisses = 0;
+size_t LccChunkPool::liveBytes = 0;
+size_t LccChunkPool::peakBytes = 0;
+
+void *LccChunkPool::allocate(size_t size)
+{
+    size_t cls = sizeClass(size);
+    if (size == 0 || cls > MAX_POOLED_SIZE / GRANULE) {
+        numMisses++;
+        return ::operator new(size);
+    }
+
+    liveBytes += cls * GRANULE;
+    peakBytes = std::max(peakBytes, liveBytes);
+
+    FreeBlock *&head = freeLists[cls - 1];
+    if (head) {
+        FreeBlock *block = head;
+        head = block->next;
+        numHits++;
+        return block;
+    }
+
+    // Boyut sınıfının tamamı ayrılır: blok daha sonra aynı sınıfta tekrar kullanılabilir
+    numMisses++;
+    return ::operator new(cls * GRANULE);
+}
+
+void LccChunkPool::deallocate(void *p, size_t size)
+{
+    if (!p) return;
+    size_t cls = sizeClass(size);
+    if (size == 0 || cls > MAX_POOLED_SIZE / GRANULE) {
+        ::operator delete(p);
+        return;
+    }
+
+    liveBytes -= cls * GRANULE;
+    if (!enabled) {
+        ::operator delete(p);
+        return;
+    }
+
+    FreeBlock *block = static_cast<FreeBlock *>(p);
+    block->next = freeLists[cls - 1];
+    freeLists[cls - 1] = block;
+}
+
+void LccChunkPool::beginRun()
+{
+    releaseAll();
+    numHits = 0;
+    numMisses = 0;
+    peakBytes = liveBytes;   // hâlâ yaşayan bloklar (varsa) yeni run'ın tabanı
+}
+
+void LccChunkPool::releaseAll()
+{
+    for (FreeBlock *&head : freeLists) {
+        while (head) {
+            FreeBlock *next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+    }
+}
+
+} // namespace inet
@@ -0,0 +1,91 @@
+#ifndef __LCCCHUNKPOOL_H_
+#define __LCCCHUNKPOOL_H_
+
+#include <omnetpp.h>
+#include "inet/common/packet/Packet.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC CHUNK POOL
+// ------------------------------------------------------------------
+// LCC chunk'ları (beacon, data, rapor ...) ve onların shared_ptr kontrol
+// blokları için boyut sınıflı serbest liste. Silinen blok heap'e dönmez,
+// aynı boyut sınıfındaki bir sonraki tahsiste tekrar kullanılır.
+//   - LccChunk::operator new/delete (dup() ile radyonun çoğalttığı kopyalar)
+//   - makePooled<T>() (makeShared yerine, chunk + kontrol bloğu tek tahsis)
+// Simülasyon tek iş parçacıklıdır; havuz process başına tektir ve sadece
+// bellek yönetimini etkiler (simülasyon sonucu değişmez). Cmdenv aynı
+// process'te birden fazla run koşturduğu için sayaçlar her run başında
+// sıfırlanır (beginRun), serbest listeler run sonunda boşaltılır (releaseAll).
+class LccChunkPool
+{
+  public:
+    static const size_t GRANULE = 16;           // boyut sınıfı adımı (byte)
+    static const size_t MAX_POOLED_SIZE = 1024; // daha büyükleri doğrudan heap
+
+  protected:
+    struct FreeBlock { FreeBlock *next; };
+    static FreeBlock *freeLists[MAX_POOLED_SIZE / GRANULE];
+    static bool enabled;
+    static uint64_t numHits;       // serbest listeden karşılanan tahsis
+    static uint64_t numMisses;     // heap'e giden tahsis
+    static size_t liveBytes;
+    static size_t peakBytes;
+
+    static size_t sizeClass(size_t size) { return (size + GRANULE - 1) / GRANULE; }
+
+  public:
+    static void *allocate(size_t size);
+    static void deallocate(void *p, size_t size);
+
+    // false: silinen bloklar heap'e döner (karşılaştırma için heap yolu)
+    static void setEnabled(bool value) { enabled = value; }
+    static bool isEnabled() { return enabled; }
+
+    // Serbest listelerde bekleyen blokları heap'e geri verir
+    static void releaseAll();
+
+    // Yeni run: önceki run'ın (teardown dahil) serbest blokları ve sayaçları silinir
+    static void beginRun();
+
+    static uint64_t getHits() { return numHits; }
+    static uint64_t getMisses() { return numMisses; }
+    static size_t getPeakBytes() { return peakBytes; }
+};
+
+// std::allocate_shared için havuz allocator'ı
+template<class T>
+struct LccPoolAllocator
+{
+    using value_type = T;
+
+    LccPoolAllocator() = default;
+    template<class U> LccPoolAllocator(const LccPoolAllocator<U>&) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(LccChunkPool::allocate(n * sizeof(T))); }
+    void deallocate(T *p, size_t n) { LccChunkPool::deallocate(p, n * sizeof(T)); }
+
+    template<class U> bool operator==(const LccPoolAllocator<U>&) const { return true; }
+    template<class U> bool operator!=(const LccPoolAllocator<U>&) const { return false; }
+};
+
+// makeShared<T>(...) yerine: chunk ve kontrol bloğu havuzdan
+template<class T, class... Args>
+Ptr<T> makePooled(Args&&... args)
+{
+#if INET_PTR_IMPLEMENTATION == INET_STD_SHARED_PTR
+    return std::allocate_shared<T>(LccPoolAllocator<T>(), std::forward<Args>(args)...);
+#else
+    return Ptr<T>(new T(std::forward<Args>(args)...));   // intrusive: LccChunk::operator new
+#endif
+}
+
+} // namespace inet
+
+#endif
@@ -0,0 +1,126 @@
+#include "LccColumnRecorder.h"
+#include <filesystem>
+
+namespace inet {
+
+Define_Module(LccColumnRecorder);
+
+// 02: ayrılmış alan yerine simtime ölçek üssü (farklı simtime-resolution ile koşulan run'lar)
+static const char LCC_COLUMN_MAGIC[8] = { 'L', 'C', 'C', 'C', 'O', 'L', '0', '2' };
+
+LccColumnRecorder::~LccColumnRecorder()
+{
+    closeAll();
+}
+
+void LccColumnRecorder::initialize()
+{
+    filePrefix = par("filePrefix").stdstringValue();
+    bufferRecords = par("bufferRecords").intValue();
+
+    // Çıktı klasörü yoksa oluştur (örn. "results/")
+    std::filesystem::path parentDir = std::filesystem::path(filePrefix).parent_path();
+    if (!parentDir.empty())
+        std::filesystem::create_directories(parentDir);
+
+    // Sinyaller network seviyesinde dinlenir: tüm host'ların LCC uygulamaları buraya yayar
+    cModule *network = getSystemModule();
+    for (const std::string& signalName : cStringTokenizer(par("signals")).asVector()) {
+        Column column;
+        column.signalName = signalName;
+        std::string base = filePrefix + "." + signalName;
+        column.timeFile = openColumnFile(base + ".time", sizeof(int64_t));
+        column.nodeFile = openColumnFile(base + ".node", sizeof(int32_t));
+        column.valueFile = openColumnFile(base + ".value", sizeof(double));
+        column.times.reserve(bufferRecords);
+        column.nodes.reserve(bufferRecords);
+        column.values.reserve(bufferRecords);
+
+        simsignal_t signalID = registerSignal(signalName.c_str());
+        columnIndex[signalID] = columns.size();
+        columns.push_back(std::move(column));
+        network->subscribe(signalID, this);
+    }
+}
+
+void LccColumnRecorder::handleMessage(cMessage *msg)
+{
+    throw cRuntimeError("LccColumnRecorder does not process messages");
+}
+
+FILE *LccColumnRecorder::openColumnFile(const std::string& fileName, uint32_t elemSize)
+{
+    FILE *f = fopen(fileName.c_str(), "wb");
+    if (!f)
+        throw cRuntimeError("LccColumnRecorder: cannot open '%s'", fileName.c_str());
+
+    int32_t scaleExp = SimTime::getScaleExp();
+    fwrite(LCC_COLUMN_MAGIC, 1, sizeof(LCC_COLUMN_MAGIC), f);
+    fwrite(&elemSize, sizeof(elemSize), 1, f);
+    fwrite(&scaleExp, sizeof(scaleExp), 1, f);
+    return f;
+}
+
+void LccColumnRecorder::append(cComponent *source, simsignal_t signalID, double value)
+{
+    auto it = columnIndex.find(signalID);
+    if (it == columnIndex.end()) return;
+
+    // Kaynak: host[i].app[0] -> node id = host index
+    cModule *host = source->getParentModule();
+    int nodeId = (host && host->isVector()) ? host->getIndex() : -1;
+
+    Column& column = columns[it->second];
+    column.times.push_back(simTime().raw());
+    column.nodes.push_back(nodeId);
+    column.values.push_back(value);
+    column.numRecords++;
+
+    if (column.times.size() >= bufferRecords)
+        flush(column);
+}
+
+void LccColumnRecorder::flush(Column& column)
+{
+    if (column.times.empty()) return;
+    fwrite(column.times.data(), sizeof(int64_t), column.times.size(), column.timeFile);
+    fwrite(column.nodes.data(), sizeof(int32_t), column.nodes.size(), column.nodeFile);
+    fwrite(column.values.data(), sizeof(double), column.values.size(), column.valueFile);
+    column.times.clear();
+    column.nodes.clear();
+    column.values.clear();
+}
+
+void LccColumnRecorder::closeAll()
+{
+    for (Column& column : columns) {
+        if (column.timeFile) flush(column);
+        for (FILE **f : { &column.timeFile, &column.nodeFile, &column.valueFile }) {
+            if (*f) { fclose(*f); *f = nullptr; }
+        }
+    }
+}
+
+void LccColumnRecorder::receiveSignal(cComponent *source, simsignal_t signalID, intval_t i, cObject *details)
+{
+    append(source, signalID, (double)i);
+}
+
+void LccColumnRecorder::receiveSignal(cComponent *source, simsignal_t signalID, double d, cObject *details)
+{
+    append(source, signalID, d);
+}
+
+void LccColumnRecorder::receiveSignal(cComponent *source, simsignal_t signalID, const SimTime& t, cObject *details)
+{
+    append(source, signalID, t.dbl());
+}
+
+void LccColumnRecorder::finish()
+{
+    for (Column& column : columns)
+        recordScalar((column.signalName + ":columnRecords").c_str(), (double)column.numRecords);
+    closeAll();
+}
+
+} // namespace inet
@@ -0,0 +1,65 @@
+#ifndef __LCCCOLUMNRECORDER_H_
+#define __LCCCOLUMNRECORDER_H_
+
+#include <omnetpp.h>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC COLUMN RECORDER
+// ------------------------------------------------------------------
+// .vec metin formatı yerine LCC sinyallerini sabit genişlikli, sadece
+// eklemeli (append-only) binary kolonlara yazar. Her sinyal için üç dosya:
+//   <prefix>.<signal>.time   int64  (simtime raw)
+//   <prefix>.<signal>.node   int32  (host index)
+//   <prefix>.<signal>.value  double
+// Her dosya 16 byte'lık başlıkla başlar ("LCCCOL02", uint32 elemSize,
+// int32 simtime ölçek üssü), böylece veri kısmı hizalı olarak mmap ile
+// okunabilir; .time değerleri raw * 10^üs saniyedir.
+class LccColumnRecorder : public cSimpleModule, public cListener
+{
+  protected:
+    struct Column {
+        std::string signalName;
+        FILE *timeFile = nullptr;
+        FILE *nodeFile = nullptr;
+        FILE *valueFile = nullptr;
+        std::vector<int64_t> times;
+        std::vector<int32_t> nodes;
+        std::vector<double> values;
+        long numRecords = 0;
+    };
+
+    std::string filePrefix;
+    size_t bufferRecords = 0;
+    std::vector<Column> columns;
+    std::map<simsignal_t, size_t> columnIndex;
+
+    FILE *openColumnFile(const std::string& fileName, uint32_t elemSize);
+    void append(cComponent *source, simsignal_t signalID, double value);
+    void flush(Column& column);
+    void closeAll();
+
+  public:
+    virtual ~LccColumnRecorder();
+
+  protected:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+
+    using cListener::receiveSignal;
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, intval_t i, cObject *details) override;
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, double d, cObject *details) override;
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, const SimTime& t, cObject *details) override;
+};
+
+} // namespace inet
+
+#endif
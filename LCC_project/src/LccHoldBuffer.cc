@@ -0,0 +1,34 @@
+#include "LccHoldBuffer.h"
+
+namespace inet {
+
+bool LccHoldBuffer::push(Entry&& entry, std::vector<Entry>& evicted)
+{
+    if ((int)queue.size() >= capacity) {
+        if (dropPolicy == HOLD_DROP_TAIL)
+            return false;
+        evicted.push_back(std::move(queue.front()));
+        queue.pop_front();
+    }
+    queue.push_back(std::move(entry));
+    return true;
+}
+
+void LccHoldBuffer::takeExpired(simtime_t now, std::vector<Entry>& expired)
+{
+    // Tüm paketler aynı holdTime ile girer: deadline sırası enqueue sırasıdır.
+    // Flush'ta geri konan paketler de sırayı korur.
+    while (!queue.empty() && queue.front().deadline <= now) {
+        expired.push_back(std::move(queue.front()));
+        queue.pop_front();
+    }
+}
+
+void LccHoldBuffer::takeAll(std::vector<Entry>& entries)
+{
+    for (Entry& entry : queue)
+        entries.push_back(std::move(entry));
+    queue.clear();
+}
+
+} // namespace inet
@@ -0,0 +1,69 @@
+#ifndef __LCCHOLDBUFFER_H_
+#define __LCCHOLDBUFFER_H_
+
+#include <omnetpp.h>
+#include "LCCMessage_m.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// Buffer doluyken yeni paket geldiğinde
+enum LccHoldDropPolicy {
+    HOLD_DROP_TAIL = 0,   // yeni paket atılır
+    HOLD_DROP_HEAD = 1    // en eski paket atılır, yeni paket girer
+};
+
+// ------------------------------------------------------------------
+// LCC HOLD BUFFER (Store-and-Forward)
+// ------------------------------------------------------------------
+// O an rotası olmayan data paketleri (CH yok, gateway yok) hemen drop
+// edilmek yerine bir süre (deadline'a kadar) burada bekler; rota oluşunca
+// LCC tekrar yönlendirmeyi dener. Sınırlı kapasite: dolunca drop politikası
+// uygulanır. Timer ve yönlendirme LCC'de kalır, bu sınıf sadece kuyruğu tutar.
+class LccHoldBuffer
+{
+  public:
+    struct Entry {
+        Ptr<const LccData> data;
+        std::string packetName;   // yönlendirme kararı paket adına bakar
+        bool originated = false;  // kendi ürettiğim paket (ilk hop henüz yok)
+        int dropReason = 0;       // süre dolarsa / atılırsa sayılacak LccDropReason
+        simtime_t enqueueTime;
+        simtime_t deadline;
+    };
+
+  protected:
+    std::deque<Entry> queue;   // enqueue sırasında (deadline'lar da artan)
+    int capacity = 0;          // 0: kapalı
+    int dropPolicy = HOLD_DROP_TAIL;
+
+  public:
+    void configure(int capacity, int dropPolicy) { this->capacity = capacity; this->dropPolicy = dropPolicy; }
+    bool isEnabled() const { return capacity > 0; }
+
+    // Buffer'a ekler. Kapasite doluysa politikaya göre ya yeni paket (false)
+    // ya da en eski paket (evicted'e yazılır, true) dışarıda kalır.
+    bool push(Entry&& entry, std::vector<Entry>& evicted);
+
+    // Flush sonrası hâlâ rotası olmayan paketi sırası bozulmadan geri koyar
+    void restore(Entry&& entry) { queue.push_back(std::move(entry)); }
+
+    // deadline <= now olan paketleri çıkarır
+    void takeExpired(simtime_t now, std::vector<Entry>& expired);
+    // Tüm paketleri çıkarır (flush)
+    void takeAll(std::vector<Entry>& entries);
+
+    // En yakın deadline; boşsa SIMTIME_MAX
+    simtime_t getEarliestDeadline() const { return queue.empty() ? SIMTIME_MAX : queue.front().deadline; }
+    bool isEmpty() const { return queue.empty(); }
+    int getLength() const { return queue.size(); }
+    void clear() { queue.clear(); }
+};
+
+} // namespace inet
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef __LCCNODESET_H_
+#define __LCCNODESET_H_
+
+#include <omnetpp.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// NODE ID KÜMESİ / TABLOSU (yoğun 0..numHosts-1 id'ler için)
+// ------------------------------------------------------------------
+// Node id'leri host[] indeksidir; std::map yerine id ile indekslenen düz
+// dizi + bit kümesi kullanılır. Dolaşım artan id sırasındadır (std::map ile
+// aynı), böylece en küçük id seçimi ve rastgele komşu seçimi değişmez.
+//
+// Kapasite (N) derleme zamanında seçilir (make MAX_NODES=64|256):
+//   - N > 0 : N bit sabit dizi, kelime sayısı sabit (64 -> tek uint64_t,
+//             256 -> 4 kelime); döngüler derleyicide açılır, heap yok
+//   - N = 0 : genel yol, kapasite başlangıçta numHosts'a göre ayrılır
+// Üye sayısı popcount ile hesaplanır.
+namespace lccnode {
+
+inline int popcount(uint64_t w) { return __builtin_popcountll(w); }
+inline int lowestBit(uint64_t w) { return __builtin_ctzll(w); }
+
+// Sabit kapasite: kelimeler nesnenin içinde
+template<size_t N>
+struct Storage
+{
+    static const size_t NUM_WORDS = (N + 63) / 64;
+    std::array<uint64_t, NUM_WORDS> words{};
+
+    void reset(int capacity) {
+        if (capacity > (int)N)
+            throw cRuntimeError("LCC was built with MAX_NODES=%d but numHosts=%d; rebuild with a larger MAX_NODES (or MAX_NODES=0)", (int)N, capacity);
+        words.fill(0);
+    }
+    int capacity() const { return N; }
+    size_t numWords() const { return NUM_WORDS; }
+};
+
+// Genel yol: kapasite çalışma zamanında sabitlenir
+template<>
+struct Storage<0>
+{
+    std::vector<uint64_t> words;
+    int cap = 0;
+
+    void reset(int capacity) { cap = capacity; words.assign((capacity + 63) / 64, 0); }
+    int capacity() const { return cap; }
+    size_t numWords() const { return words.size(); }
+};
+
+} // namespace lccnode
+
+template<size_t N>
+class LccNodeSet
+{
+  protected:
+    lccnode::Storage<N> bits;
+
+  public:
+    class const_iterator
+    {
+      protected:
+        const LccNodeSet *set;
+        int id;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int *;
+        using reference = int;
+
+        const_iterator(const LccNodeSet *set, int id) : set(set), id(id) {}
+        int operator*() const { return id; }
+        const_iterator& operator++() { id = set->next(id + 1); return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        bool operator==(const const_iterator& o) const { return id == o.id; }
+        bool operator!=(const const_iterator& o) const { return id != o.id; }
+    };
+
+    // Kapasiteyi ayarlar ve kümeyi boşaltır (initialize'da numHosts ile)
+    void reset(int capacity) { bits.reset(capacity); }
+    int capacity() const { return bits.capacity(); }
+
+    bool contains(int id) const {
+        return id >= 0 && id < bits.capacity() && (bits.words[id >> 6] >> (id & 63) & 1);
+    }
+    // true: id yeni eklendi
+    bool insert(int id) {
+        if (id < 0 || id >= bits.capacity())
+            throw cRuntimeError("Node id %d out of range [0, %d)", id, bits.capacity());
+        uint64_t mask = uint64_t(1) << (id & 63);
+        bool added = !(bits.words[id >> 6] & mask);
+        bits.words[id >> 6] |= mask;
+        return added;
+    }
+    // true: id kümedeydi
+    bool erase(int id) {
+        if (!contains(id)) return false;
+        bits.words[id >> 6] &= ~(uint64_t(1) << (id & 63));
+        return true;
+    }
+    void clear() {
+        for (size_t w = 0; w < bits.numWords(); w++) bits.words[w] = 0;
+    }
+    // mask'taki id'leri siler (numWords kelime, LccScan maskeleri)
+    void eraseMask(const uint64_t *mask, size_t numWords) {
+        for (size_t w = 0; w < numWords && w < bits.numWords(); w++) bits.words[w] &= ~mask[w];
+    }
+    // other'da olmayan id'leri siler
+    void retain(const LccNodeSet& other) {
+        for (size_t w = 0; w < bits.numWords(); w++) bits.words[w] &= other.bits.words[w];
+    }
+    const uint64_t *words() const { return bits.words.data(); }
+
+    int size() const {
+        int n = 0;
+        for (size_t w = 0; w < bits.numWords(); w++) n += lccnode::popcount(bits.words[w]);
+        return n;
+    }
+    bool empty() const {
+        for (size_t w = 0; w < bits.numWords(); w++)
+            if (bits.words[w]) return false;
+        return true;
+    }
+
+    // from dahil, from'dan büyük/eşit ilk id; yoksa capacity()
+    int next(int from) const {
+        if (from >= bits.capacity()) return bits.capacity();
+        size_t w = from >> 6;
+        uint64_t word = bits.words[w] & (~uint64_t(0) << (from & 63));
+        while (true) {
+            if (word) return int(w * 64) + lccnode::lowestBit(word);
+            if (++w >= bits.numWords()) return bits.capacity();
+            word = bits.words[w];
+        }
+    }
+
+    const_iterator begin() const { return const_iterator(this, next(0)); }
+    const_iterator end() const { return const_iterator(this, bits.capacity()); }
+};
+
+// id -> değer tablosu: std::map<int, V> ile aynı arayüzün kullanılan kısmı
+// (find/end, operator[], erase(id), erase(it), artan id sırasında dolaşım).
+// Dolaşımda eleman std::pair<const int, V&> olarak döner.
+template<class V, size_t N>
+class LccNodeMap
+{
+  protected:
+    LccNodeSet<N> present;
+    typename std::conditional<N == 0, std::vector<V>, std::array<V, N == 0 ? 1 : N>>::type values;
+
+    void resizeValues(int capacity, std::true_type) { values.assign(capacity, V()); }
+    void resizeValues(int capacity, std::false_type) { values.fill(V()); }
+
+    template<class M, class R>
+    class Iterator
+    {
+      protected:
+        M *map;
+        int id;
+
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const int, R&>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+        struct pointer {
+            value_type entry;
+            value_type *operator->() { return &entry; }
+        };
+
+        Iterator(M *map, int id) : map(map), id(id) {}
+        template<class M2, class R2>
+        Iterator(const Iterator<M2, R2>& o) : map(o.map), id(o.id) {}
+
+        value_type operator*() const { return value_type(id, map->values[id]); }
+        pointer operator->() const { return pointer{**this}; }
+        Iterator& operator++() { id = map->present.next(id + 1); return *this; }
+        Iterator operator++(int) { Iterator old = *this; ++*this; return old; }
+        bool operator==(const Iterator& o) const { return id == o.id; }
+        bool operator!=(const Iterator& o) const { return id != o.id; }
+
+        template<class M2, class R2> friend class Iterator;
+        friend class LccNodeMap;
+    };
+
+  public:
+    using iterator = Iterator<LccNodeMap, V>;
+    using const_iterator = Iterator<const LccNodeMap, const V>;
+
+    void reset(int capacity) {
+        present.reset(capacity);
+        resizeValues(capacity, std::integral_constant<bool, N == 0>());
+    }
+
+    int size() const { return present.size(); }
+    bool empty() const { return present.empty(); }
+    int count(int id) const { return present.contains(id) ? 1 : 0; }
+    const LccNodeSet<N>& keys() const { return present; }
+
+    // Yoksa varsayılan değerle ekler
+    V& operator[](int id) {
+        if (present.insert(id)) values[id] = V();
+        return values[id];
+    }
+
+    iterator find(int id) { return iterator(this, present.contains(id) ? id : present.capacity()); }
+    const_iterator find(int id) const { return const_iterator(this, present.contains(id) ? id : present.capacity()); }
+
+    int erase(int id) { return present.erase(id) ? 1 : 0; }
+    iterator erase(iterator it) {
+        present.erase(it.id);
+        return iterator(this, present.next(it.id + 1));
+    }
+    void clear() { present.clear(); }
+    void eraseMask(const uint64_t *mask, size_t numWords) { present.eraseMask(mask, numWords); }
+    void retainKeys(const LccNodeSet<N>& keys) { present.retain(keys); }
+
+    // id ile indekslenen değer dizisi (mevcut olmayan id'lerin değeri anlamsız)
+    const V *data() const { return values.data(); }
+
+    iterator begin() { return iterator(this, present.next(0)); }
+    iterator end() { return iterator(this, present.capacity()); }
+    const_iterator begin() const { return const_iterator(this, present.next(0)); }
+    const_iterator end() const { return const_iterator(this, present.capacity()); }
+};
+
+} // namespace inet
+
+#endif
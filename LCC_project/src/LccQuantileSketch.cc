@@ -0,0 +1,98 @@
+#include "LccQuantileSketch.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace inet {
+
+LccQuantileSketch::LccQuantileSketch(double minValue, double maxValue, double relativeError) :
+    minValue(minValue), maxValue(maxValue), relativeError(relativeError)
+{
+    if (minValue <= 0 || maxValue <= minValue || relativeError <= 0 || relativeError >= 1)
+        throw std::invalid_argument("LccQuantileSketch: invalid range or relative error");
+
+    // Kova temsilcisi 2*gamma^i/(gamma+1) seçildiğinde bağıl hata <= relativeError olur
+    gamma = (1 + relativeError) / (1 - relativeError);
+    logGamma = std::log(gamma);
+    int numBuckets = (int)std::ceil(std::log(maxValue / minValue) / logGamma) + 1;
+    buckets.assign(numBuckets, 0);
+}
+
+int LccQuantileSketch::bucketIndex(double value) const
+{
+    int index = (int)std::ceil(std::log(value / minValue) / logGamma) - 1;
+    return std::clamp(index, 0, (int)buckets.size() - 1);
+}
+
+double LccQuantileSketch::bucketValue(int index) const
+{
+    // (minValue*gamma^i, minValue*gamma^(i+1)] aralığının bağıl-hata ortası
+    return minValue * 2 * std::pow(gamma, index + 1) / (gamma + 1);
+}
+
+void LccQuantileSketch::add(double value)
+{
+    if (count == 0) { min = max = value; }
+    else { min = std::min(min, value); max = std::max(max, value); }
+    count++;
+    sum += value;
+
+    if (value < minValue) zeroCount++;
+    else buckets[bucketIndex(value)]++;
+}
+
+void LccQuantileSketch::merge(const LccQuantileSketch& other)
+{
+    if (other.buckets.size() != buckets.size() || other.minValue != minValue || other.gamma != gamma)
+        throw std::invalid_argument("LccQuantileSketch: cannot merge sketches with different parameters");
+    if (other.count == 0) return;
+
+    if (count == 0) { min = other.min; max = other.max; }
+    else { min = std::min(min, other.min); max = std::max(max, other.max); }
+    count += other.count;
+    sum += other.sum;
+    zeroCount += other.zeroCount;
+    for (size_t i = 0; i < buckets.size(); i++)
+        buckets[i] += other.buckets[i];
+}
+
+void LccQuantileSketch::clear()
+{
+    std::fill(buckets.begin(), buckets.end(), 0);
+    zeroCount = 0;
+    count = 0;
+    sum = min = max = 0;
+}
+
+double LccQuantileSketch::quantile(double q) const
+{
+    if (count == 0) return 0.0;
+
+    double rank = std::clamp(q, 0.0, 1.0) * (count - 1);
+    uint64_t cumulative = zeroCount;
+    if (rank < cumulative) return min;
+
+    for (size_t i = 0; i < buckets.size(); i++) {
+        cumulative += buckets[i];
+        if (rank < cumulative)
+            return std::clamp(bucketValue(i), min, max);
+    }
+    return max;
+}
+
+void LccQuantileSketch::writeCsv(std::ostream& out) const
+{
+    out << minValue << "," << maxValue << "," << relativeError << ","
+        << count << "," << sum << "," << min << "," << max << "," << zeroCount << ",";
+
+    // Seyrek kovalar: sadece dolu olanlar yazılır
+    bool first = true;
+    for (size_t i = 0; i < buckets.size(); i++) {
+        if (buckets[i] == 0) continue;
+        if (!first) out << " ";
+        out << i << ":" << buckets[i];
+        first = false;
+    }
+}
+
+} // namespace inet
@@ -0,0 +1,58 @@
+#ifndef __LCCQUANTILESKETCH_H_
+#define __LCCQUANTILESKETCH_H_
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC QUANTILE SKETCH
+// ------------------------------------------------------------------
+// Logaritmik kovalı (HDR/DDSketch tarzı) akış histogramı. Kova sayısı
+// kurulumda [minValue, maxValue] aralığı ve bağıl hata ile sabitlenir;
+// simülasyon ne kadar uzun sürerse sürsün bellek sabit kalır.
+// Aynı parametreli iki sketch kovaları toplanarak birleştirilebilir
+// (node bazlı sketch'ler -> ağ geneli).
+class LccQuantileSketch
+{
+  protected:
+    double minValue;
+    double maxValue;
+    double relativeError;
+    double gamma;
+    double logGamma;
+
+    uint64_t zeroCount = 0;          // minValue altındaki değerler (0 dahil)
+    std::vector<uint64_t> buckets;   // i. kova: (minValue*gamma^i, minValue*gamma^(i+1)] (0. kova minValue dahil)
+    uint64_t count = 0;
+    double sum = 0;
+    double min = 0;
+    double max = 0;
+
+    int bucketIndex(double value) const;
+    double bucketValue(int index) const;
+
+  public:
+    LccQuantileSketch(double minValue, double maxValue, double relativeError);
+
+    void add(double value);
+    void merge(const LccQuantileSketch& other);
+    void clear();
+
+    uint64_t getCount() const { return count; }
+    double getMean() const { return count > 0 ? sum / count : 0.0; }
+    double getMin() const { return min; }
+    double getMax() const { return max; }
+
+    // q in [0,1]; boş sketch için 0
+    double quantile(double q) const;
+
+    // CSV satırı: minValue,maxValue,relErr,count,sum,min,max,zeroCount,"idx:cnt idx:cnt ..."
+    void writeCsv(std::ostream& out) const;
+};
+
+} // namespace inet
+
+#endif
@@ -0,0 +1,154 @@
+#include "LccScan.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LCC_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+namespace inet {
+
+static inline int popcount64(uint64_t w) { return __builtin_popcountll(w); }
+
+static void prepare(int n, LccNeighborScan& scan)
+{
+    size_t numWords = (n + 63) / 64;
+    scan.expired.assign(numWords, 0);
+    scan.members.assign(numWords, 0);
+    scan.heads.assign(numWords, 0);
+    scan.numExpired = scan.numMembers = scan.numHeads = 0;
+}
+
+// Bir kelimenin maskelerini yazar ve sayaçları günceller
+static inline void storeWord(size_t w, uint64_t live, uint64_t old, uint64_t member, uint64_t head, LccNeighborScan& scan)
+{
+    uint64_t expired = old & live;
+    live &= ~expired;
+    scan.expired[w] = expired;
+    scan.members[w] = member & live;
+    scan.heads[w] = head & live;
+    scan.numExpired += popcount64(expired);
+    scan.numMembers += popcount64(scan.members[w]);
+    scan.numHeads += popcount64(scan.heads[w]);
+}
+
+// ------------------------------------------------------------------
+// SKALER ÇEKİRDEK (sadece mevcut id'leri gezer)
+// ------------------------------------------------------------------
+void lccScanNeighborsScalar(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                            int64_t expiryBefore, LccNeighborScan& scan)
+{
+    prepare(n, scan);
+    for (size_t w = 0; w < scan.expired.size(); w++) {
+        uint64_t live = present[w];
+        if (!live) continue;
+        uint64_t old = 0, member = 0, head = 0;
+        for (uint64_t bits = live; bits; bits &= bits - 1) {
+            int b = __builtin_ctzll(bits);
+            int id = (int)w * 64 + b;
+            uint64_t bit = uint64_t(1) << b;
+            if (lastSeen[id] < expiryBefore) old |= bit;
+            if (roles[id] == 1) member |= bit;
+            else if (roles[id] == 2) head |= bit;
+        }
+        storeWord(w, live, old, member, head, scan);
+    }
+}
+
+// ------------------------------------------------------------------
+// AVX2 ÇEKİRDEĞİ (kelime başına 8'li gruplar: 2x4 int64 + 8 int32)
+// ------------------------------------------------------------------
+#ifdef LCC_SCAN_X86
+__attribute__((target("avx2")))
+static void lccScanNeighborsAvx2(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                                 int64_t expiryBefore, LccNeighborScan& scan)
+{
+    prepare(n, scan);
+    const __m256i threshold = _mm256_set1_epi64x(expiryBefore);
+    const __m256i roleMember = _mm256_set1_epi32(1);
+    const __m256i roleHead = _mm256_set1_epi32(2);
+
+    for (size_t w = 0; w < scan.expired.size(); w++) {
+        uint64_t live = present[w];
+        if (!live) continue;
+        int base = (int)w * 64;
+        int len = std::min(64, n - base);
+        uint64_t old = 0, member = 0, head = 0;
+        int j = 0;
+        for (; j + 8 <= len; j += 8) {
+            if (!(live >> j & 0xff)) continue;   // bu 8'li grupta komşu yok
+            __m256i t0 = _mm256_loadu_si256((const __m256i *)(lastSeen + base + j));
+            __m256i t1 = _mm256_loadu_si256((const __m256i *)(lastSeen + base + j + 4));
+            __m256i r = _mm256_loadu_si256((const __m256i *)(roles + base + j));
+            uint64_t o = (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(threshold, t0)))
+                       | (uint64_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(threshold, t1))) << 4;
+            uint64_t m = (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(r, roleMember)));
+            uint64_t h = (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(r, roleHead)));
+            old |= o << j;
+            member |= m << j;
+            head |= h << j;
+        }
+        for (; j < len; j++) {
+            uint64_t bit = uint64_t(1) << j;
+            if (lastSeen[base + j] < expiryBefore) old |= bit;
+            if (roles[base + j] == 1) member |= bit;
+            else if (roles[base + j] == 2) head |= bit;
+        }
+        storeWord(w, live, old, member, head, scan);
+    }
+}
+#endif
+
+LccScanKernel lccScanAvx2Kernel()
+{
+#ifdef LCC_SCAN_X86
+    if (__builtin_cpu_supports("avx2"))
+        return lccScanNeighborsAvx2;
+#endif
+    return nullptr;
+}
+
+static LccScanKernel selectedKernel()
+{
+    static const LccScanKernel kernel = lccScanAvx2Kernel() ? lccScanAvx2Kernel() : lccScanNeighborsScalar;
+    return kernel;
+}
+
+void lccScanNeighbors(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                      int64_t expiryBefore, LccNeighborScan& scan)
+{
+    selectedKernel()(lastSeen, roles, present, n, expiryBefore, scan);
+}
+
+const char *lccScanKernelName()
+{
+    return selectedKernel() == lccScanNeighborsScalar ? "scalar" : "avx2";
+}
+
+// ------------------------------------------------------------------
+// MASKE YARDIMCILARI
+// ------------------------------------------------------------------
+int lccMaskNext(const std::vector<uint64_t>& mask, int from)
+{
+    if (from < 0) from = 0;
+    size_t w = from >> 6;
+    if (w >= mask.size()) return -1;
+    uint64_t word = mask[w] & (~uint64_t(0) << (from & 63));
+    while (true) {
+        if (word) return (int)w * 64 + __builtin_ctzll(word);
+        if (++w >= mask.size()) return -1;
+        word = mask[w];
+    }
+}
+
+int lccMaskCountBelow(const std::vector<uint64_t>& mask, int id)
+{
+    int count = 0;
+    size_t full = std::min(mask.size(), (size_t)(id >> 6));
+    for (size_t w = 0; w < full; w++) count += popcount64(mask[w]);
+    if (full < mask.size() && (id & 63))
+        count += popcount64(mask[full] & ((uint64_t(1) << (id & 63)) - 1));
+    return count;
+}
+
+} // namespace inet
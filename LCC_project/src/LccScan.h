@@ -0,0 +1,60 @@
+#ifndef __LCCSCAN_H_
+#define __LCCSCAN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC KOMŞU TARAMASI (SIMD)
+// ------------------------------------------------------------------
+// checkTimeouts + runLCCLogic'in ihtiyaç duyduğu her şey id ile indekslenen
+// dizilerden tek geçişte çıkarılır:
+//   - expired : mevcut ve lastSeen < expiryBefore (now - lastSeen > validity)
+//   - members : süresi dolmamış ve rolü 1 (Member)
+//   - heads   : süresi dolmamış ve rolü 2 (CH)
+// Maskeler 64 id'lik kelimelerdir (LccNodeSet ile aynı düzen); en düşük id
+// aramaları maskedeki ilk bit, üye sayısı popcount'tur.
+// AVX2 çekirdeği çalışma zamanında CPU destekliyorsa seçilir, yoksa skaler.
+struct LccNeighborScan
+{
+    std::vector<uint64_t> expired;
+    std::vector<uint64_t> members;
+    std::vector<uint64_t> heads;
+    int numExpired = 0;
+    int numMembers = 0;
+    int numHeads = 0;
+};
+
+// lastSeen: simtime raw değerleri, roles: LCC rolü, present: mevcut id bitleri
+// (n id için (n+63)/64 kelime). Sonuç maskeleri scan içinde boyutlandırılır.
+typedef void (*LccScanKernel)(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                              int64_t expiryBefore, LccNeighborScan& scan);
+
+void lccScanNeighborsScalar(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                            int64_t expiryBefore, LccNeighborScan& scan);
+// nullptr: bu derleme / CPU için AVX2 yok
+LccScanKernel lccScanAvx2Kernel();
+
+// Seçili çekirdek (AVX2 varsa o, yoksa skaler)
+void lccScanNeighbors(const int64_t *lastSeen, const int *roles, const uint64_t *present, int n,
+                      int64_t expiryBefore, LccNeighborScan& scan);
+const char *lccScanKernelName();
+
+// --- Maske yardımcıları ---
+inline bool lccMaskTest(const std::vector<uint64_t>& mask, int id)
+{
+    return id >= 0 && (size_t)(id >> 6) < mask.size() && (mask[id >> 6] >> (id & 63) & 1);
+}
+
+// from'dan büyük/eşit ilk bit; yoksa -1
+int lccMaskNext(const std::vector<uint64_t>& mask, int from);
+
+// id'den küçük bit sayısı
+int lccMaskCountBelow(const std::vector<uint64_t>& mask, int id);
+
+} // namespace inet
+
+#endif
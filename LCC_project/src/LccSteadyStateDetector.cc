@@ -0,0 +1,125 @@
+#include "LccSteadyStateDetector.h"
+#include "LCC.h"
+
+namespace inet {
+
+Define_Module(LccSteadyStateDetector);
+
+LccSteadyStateDetector::~LccSteadyStateDetector()
+{
+    cancelAndDelete(observationTimer);
+}
+
+void LccSteadyStateDetector::initialize()
+{
+    observationInterval = par("observationInterval").doubleValue();
+    batchSize = par("batchSize");
+    minBatches = par("minBatches");
+    if (observationInterval <= SIMTIME_ZERO || batchSize < 1 || minBatches < 2)
+        throw cRuntimeError("LccSteadyStateDetector: invalid observationInterval/batchSize/minBatches");
+
+    // roleChangeSignal tüm host'lardan network seviyesine yayılır
+    getSystemModule()->subscribe(registerSignal("roleChangeSignal"), this);
+
+    observationTimer = new cMessage("observationTimer");
+    scheduleAt(simTime() + observationInterval, observationTimer);
+}
+
+void LccSteadyStateDetector::handleMessage(cMessage *msg)
+{
+    if (msg != observationTimer)
+        throw cRuntimeError("LccSteadyStateDetector does not process messages");
+
+    observations.push_back(currentCount);
+    currentCount = 0;
+    for (LCC *app : lccApps())
+        app->markStatistics();
+
+    if (observations.size() % batchSize == 0)
+        checkSteadyState();
+    if (!detected)
+        scheduleAt(simTime() + observationInterval, observationTimer);
+}
+
+void LccSteadyStateDetector::receiveSignal(cComponent *source, simsignal_t signalID, intval_t i, cObject *details)
+{
+    currentCount += i;
+}
+
+int LccSteadyStateDetector::mserTruncation(const std::vector<double>& batchMeans)
+{
+    // Sondan geriye toplamlar: O(m) ile her d için kalan serinin varyansı
+    int m = batchMeans.size();
+    double sum = 0, sumSq = 0;
+    double bestValue = -1;
+    int best = m - 1;
+    for (int d = m - 1; d >= 0; d--) {
+        sum += batchMeans[d];
+        sumSq += batchMeans[d] * batchMeans[d];
+        int remaining = m - d;
+        if (remaining < 2) continue;   // tek batch: varyans anlamsız
+        double value = (sumSq - sum * sum / remaining) / ((double)remaining * remaining);
+        if (bestValue < 0 || value <= bestValue) {   // eşitlikte daha erken kesme
+            bestValue = value;
+            best = d;
+        }
+    }
+    return best;
+}
+
+void LccSteadyStateDetector::checkSteadyState()
+{
+    int m = observations.size() / batchSize;
+    if (m < minBatches) return;
+
+    std::vector<double> batchMeans(m);
+    for (int j = 0; j < m; j++) {
+        double sum = 0;
+        for (int k = 0; k < batchSize; k++)
+            sum += observations[j * batchSize + k];
+        batchMeans[j] = sum / batchSize;
+    }
+
+    // d* serinin ikinci yarısındaysa run henüz geçiş dönemini aşmadı
+    int d = mserTruncation(batchMeans);
+    if (d > m / 2) return;
+
+    declareSteadyState(observationInterval * (double)(d * batchSize));
+}
+
+void LccSteadyStateDetector::declareSteadyState(simtime_t truncationTime)
+{
+    detected = true;
+    EV << "STEADY STATE: MSER kesme noktasi " << truncationTime << " (tespit " << simTime() << ")" << endl;
+
+    // Kesme noktası geçmişte: sayaçlar o andaki gözlem kopyası çıkarılarak
+    // geriye dönük kesilir, ölçüm penceresi truncationTime'dan başlar
+    for (LCC *app : lccApps())
+        app->truncateStatistics(truncationTime);
+
+    recordScalar("truncationTime", truncationTime);
+    recordScalar("detectionTime", simTime());
+}
+
+const std::vector<LCC *>& LccSteadyStateDetector::lccApps()
+{
+    if (apps.empty()) {
+        cModule *network = getSystemModule();
+        int numHosts = network->getSubmoduleVectorSize("host");
+        for (int i = 0; i < numHosts; i++) {
+            cModule *host = network->getSubmodule("host", i);
+            if (auto lcc = dynamic_cast<LCC *>(host ? host->getSubmodule("app", 0) : nullptr))
+                apps.push_back(lcc);
+        }
+    }
+    return apps;
+}
+
+void LccSteadyStateDetector::finish()
+{
+    if (!detected)
+        EV << "STEADY STATE: run boyunca kararli duruma ulasilamadi (" << observations.size() << " gozlem)" << endl;
+    recordScalar("steadyStateDetected", detected ? 1 : 0);
+}
+
+} // namespace inet
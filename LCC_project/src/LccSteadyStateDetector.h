@@ -0,0 +1,56 @@
+#ifndef __LCCSTEADYSTATEDETECTOR_H_
+#define __LCCSTEADYSTATEDETECTOR_H_
+
+#include <omnetpp.h>
+#include <vector>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC STEADY-STATE DETECTOR (MSER-5)
+// ------------------------------------------------------------------
+// Tüm host'ların roleChangeSignal'ini network seviyesinde dinler ve
+// observationInterval başına rol değişimi sayısını biriktirir. Her yeni
+// batch'te (batchSize gözlem) MSER kuralı çalıştırılır; optimum kesme
+// noktası serinin ilk yarısında kalınca kümelenmenin oturduğu kabul edilir.
+// Her gözlem sonunda LCC sayaçlarının kopyası alınır (LCC::markStatistics);
+// kesme geriye dönük uygulanır (LCC::truncateStatistics), yani ölçüm
+// penceresi tespit anından değil kesme noktasından başlar.
+class LCC;
+
+class LccSteadyStateDetector : public cSimpleModule, public cListener
+{
+  protected:
+    simtime_t observationInterval;
+    int batchSize = 5;
+    int minBatches = 8;
+    cMessage *observationTimer = nullptr;
+
+    long currentCount = 0;                 // mevcut aralıktaki rol değişimi
+    std::vector<double> observations;      // aralık başına rol değişimi
+    bool detected = false;
+    std::vector<LCC *> apps;               // host[*].app[0] (ilk gözlemde bulunur)
+
+    // Batch ortalamaları üzerinde MSER: argmin_d  S^2(d) / (m - d)
+    static int mserTruncation(const std::vector<double>& batchMeans);
+    void checkSteadyState();
+    void declareSteadyState(simtime_t truncationTime);
+    const std::vector<LCC *>& lccApps();
+
+  public:
+    virtual ~LccSteadyStateDetector();
+
+  protected:
+    virtual void initialize() override;
+    virtual void handleMessage(cMessage *msg) override;
+    virtual void finish() override;
+
+    using cListener::receiveSignal;
+    virtual void receiveSignal(cComponent *source, simsignal_t signalID, intval_t i, cObject *details) override;
+};
+
+} // namespace inet
+
+#endif
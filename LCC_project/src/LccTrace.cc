@@ -0,0 +1,362 @@
+#include "LccTrace.h"
+#include "inet/physicallayer/wireless/common/contract/packetlevel/SignalTag_m.h"
+#include <algorithm>
+#include <cstring>
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// YARDIMCI FONKSİYONLAR (Binary okuma / yazma)
+// ------------------------------------------------------------------
+template<typename T>
+static void writeValue(std::ofstream& out, T value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template<typename T>
+static bool readValue(std::ifstream& in, T& value)
+{
+    in.read(reinterpret_cast<char *>(&value), sizeof(T));
+    return (bool)in;
+}
+
+// Dosya başlığı: eski / farklı formattaki trace sessizce çöp okunmasın
+static const uint32_t TRACE_MAGIC = 0x5443434c;   // "LCCT"
+static const uint16_t TRACE_FORMAT_VERSION = 2;   // 2: cluster cast / üye raporu kayıtları
+
+static void writeHeader(std::ofstream& out, simtime_t arrivalTime, uint8_t recordType, const Packet *packet)
+{
+    const char *name = packet->getName();
+    size_t nameLen = std::min<size_t>(strlen(name), 255);
+
+    writeValue<int64_t>(out, arrivalTime.raw());
+    writeValue<uint8_t>(out, recordType);
+    writeValue<uint32_t>(out, (uint32_t)packet->getByteLength());
+    writeValue<uint8_t>(out, (uint8_t)nameLen);
+    out.write(name, nameLen);
+
+    const SnirInd *snirInd = packet->findTag<SnirInd>();
+    writeValue<double>(out, snirInd ? snirInd->getMinimumSnir() : -1.0);
+}
+
+// ------------------------------------------------------------------
+// WRITER
+// ------------------------------------------------------------------
+void LccTraceWriter::open(const std::string& fileName)
+{
+    out.open(fileName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+        throw cRuntimeError("LCC trace: cannot open '%s' for writing", fileName.c_str());
+    writeValue<uint32_t>(out, TRACE_MAGIC);
+    writeValue<uint16_t>(out, TRACE_FORMAT_VERSION);
+    writeValue<int8_t>(out, (int8_t)SimTime::getScaleExp());
+}
+
+void LccTraceWriter::close()
+{
+    if (out.is_open())
+        out.close();
+}
+
+void LccTraceWriter::writeBeacon(simtime_t arrivalTime, const Packet *packet, const LccBeacon& beacon)
+{
+    writeHeader(out, arrivalTime, TRACE_BEACON, packet);
+    writeValue<int32_t>(out, beacon.getSrcId());
+    writeValue<int8_t>(out, (int8_t)beacon.getRole());
+    writeValue<int32_t>(out, beacon.getClusterHeadId());
+
+    uint16_t n = (uint16_t)beacon.getSeenClusterIdsArraySize();
+    writeValue<uint16_t>(out, n);
+    for (uint16_t k = 0; k < n; k++)
+        writeValue<int32_t>(out, beacon.getSeenClusterIds(k));
+    writeValue<int32_t>(out, beacon.getBackupChId());
+
+    writeValue<uint8_t>(out, (beacon.getHasMobility() ? 1 : 0) | (beacon.getSolicit() ? 2 : 0));
+    if (beacon.getHasMobility()) {
+        writeValue<double>(out, beacon.getPosX());
+        writeValue<double>(out, beacon.getPosY());
+        writeValue<double>(out, beacon.getVelX());
+        writeValue<double>(out, beacon.getVelY());
+    }
+
+    writeValue<uint8_t>(out, (uint8_t)beacon.getChHops());
+    writeValue<int32_t>(out, beacon.getParentId());
+    uint16_t m = (uint16_t)beacon.getSubtreeIdsArraySize();
+    writeValue<uint16_t>(out, m);
+    for (uint16_t k = 0; k < m; k++)
+        writeValue<int32_t>(out, beacon.getSubtreeIds(k));
+}
+
+void LccTraceWriter::writeData(simtime_t arrivalTime, const Packet *packet, const LccData& data)
+{
+    writeHeader(out, arrivalTime, TRACE_DATA, packet);
+    writeValue<int32_t>(out, data.getSrcId());
+    writeValue<int32_t>(out, data.getDestId());
+    writeValue<int64_t>(out, data.getSendTime().raw());
+    writeValue<int32_t>(out, data.getSeqNo());
+    writeValue<int16_t>(out, (int16_t)data.getHopLimit());
+    writeValue<int32_t>(out, data.getTargetClusterId());
+
+    uint8_t n = (uint8_t)std::min<size_t>(data.getHopIdsArraySize(), 255);
+    writeValue<uint8_t>(out, data.getTraceHops() ? 1 : 0);
+    writeValue<uint8_t>(out, n);
+    for (uint8_t k = 0; k < n; k++) {
+        writeValue<int32_t>(out, data.getHopIds(k));
+        writeValue<int8_t>(out, (int8_t)data.getHopRoles(k));
+        writeValue<int8_t>(out, (int8_t)data.getHopKinds(k));
+        writeValue<int64_t>(out, data.getHopTimes(k).raw());
+    }
+}
+
+void LccTraceWriter::writeClusterCast(simtime_t arrivalTime, const Packet *packet, const LccClusterCast& cast)
+{
+    writeHeader(out, arrivalTime, TRACE_CLUSTER_CAST, packet);
+    writeValue<int32_t>(out, cast.getSrcId());
+    writeValue<int32_t>(out, cast.getClusterId());
+    writeValue<int8_t>(out, (int8_t)cast.getKind());
+    writeValue<int32_t>(out, cast.getSeqNo());
+
+    uint16_t n = (uint16_t)cast.getMemberIdsArraySize();
+    writeValue<uint16_t>(out, n);
+    for (uint16_t k = 0; k < n; k++)
+        writeValue<int32_t>(out, cast.getMemberIds(k));
+    uint16_t m = (uint16_t)cast.getMemberValuesArraySize();
+    writeValue<uint16_t>(out, m);
+    for (uint16_t k = 0; k < m; k++)
+        writeValue<int32_t>(out, cast.getMemberValues(k));
+    writeValue<int32_t>(out, cast.getBackupChId());
+}
+
+void LccTraceWriter::writeReport(simtime_t arrivalTime, const Packet *packet, const LccReport& report)
+{
+    writeHeader(out, arrivalTime, TRACE_REPORT, packet);
+    writeValue<int32_t>(out, report.getSrcId());
+    writeValue<int32_t>(out, report.getClusterId());
+    writeValue<int32_t>(out, report.getNeighborCount());
+}
+
+// ------------------------------------------------------------------
+// READER
+// ------------------------------------------------------------------
+void LccTraceReader::open(const std::string& fileName)
+{
+    in.open(fileName, std::ios::in | std::ios::binary);
+    if (!in.is_open())
+        throw cRuntimeError("LCC trace: cannot open '%s' for reading", fileName.c_str());
+    this->fileName = fileName;
+
+    uint32_t magic;
+    uint16_t version;
+    int8_t scaleExp;
+    if (!readValue(in, magic) || magic != TRACE_MAGIC)
+        throw cRuntimeError("LCC trace: '%s' is not an LCC trace file (missing header)", fileName.c_str());
+    if (!readValue(in, version) || version != TRACE_FORMAT_VERSION)
+        throw cRuntimeError("LCC trace: '%s' has format version %d, expected %d; record it again",
+                            fileName.c_str(), (int)version, (int)TRACE_FORMAT_VERSION);
+    if (!readValue(in, scaleExp) || scaleExp != SimTime::getScaleExp())
+        throw cRuntimeError("LCC trace: '%s' was recorded with simtime-resolution 10^%d s, current is 10^%d s",
+                            fileName.c_str(), (int)scaleExp, SimTime::getScaleExp());
+    readNext();
+}
+
+void LccTraceReader::close()
+{
+    delete nextPacket;
+    nextPacket = nullptr;
+    hasRecord = false;
+    if (in.is_open())
+        in.close();
+}
+
+Packet *LccTraceReader::takeNext()
+{
+    Packet *packet = nextPacket;
+    nextPacket = nullptr;
+    readNext();
+    return packet;
+}
+
+void LccTraceReader::truncated() const
+{
+    throw cRuntimeError("LCC trace: '%s' ends in the middle of a record (truncated file?)", fileName.c_str());
+}
+
+bool LccTraceReader::readNext()
+{
+    hasRecord = false;
+
+    // Kayıt sınırında dosya sonu: replay bitti. Kaydın ortasında biten dosya hatadır.
+    int64_t arrivalRaw;
+    if (!readValue(in, arrivalRaw)) {
+        if (in.gcount() == 0)
+            return false;
+        truncated();
+    }
+
+    uint8_t recordType, nameLen;
+    uint32_t byteLength;
+    if (!readValue(in, recordType) || !readValue(in, byteLength) || !readValue(in, nameLen))
+        truncated();
+
+    char name[256];
+    in.read(name, nameLen);
+    if (!in)
+        truncated();
+    name[nameLen] = '\0';
+
+    double snir;
+    if (!readValue(in, snir))
+        truncated();
+
+    if (recordType == TRACE_BEACON) {
+        int32_t srcId, clusterHeadId;
+        int8_t role;
+        uint16_t n;
+        if (!readValue(in, srcId) || !readValue(in, role) || !readValue(in, clusterHeadId) || !readValue(in, n))
+            truncated();
+
+        auto beacon = makePooled<LccBeacon>();
+        beacon->setSrcId(srcId);
+        beacon->setRole(role);
+        beacon->setClusterHeadId(clusterHeadId);
+        beacon->setSeenClusterIdsArraySize(n);
+        for (uint16_t k = 0; k < n; k++) {
+            int32_t clusterId;
+            if (!readValue(in, clusterId))
+                truncated();
+            beacon->setSeenClusterIds(k, clusterId);
+        }
+
+        int32_t backupChId;
+        uint8_t flags;
+        if (!readValue(in, backupChId) || !readValue(in, flags))
+            truncated();
+        beacon->setBackupChId(backupChId);
+        beacon->setSolicit(flags & 2);
+        if (flags & 1) {
+            double posX, posY, velX, velY;
+            if (!readValue(in, posX) || !readValue(in, posY) || !readValue(in, velX) || !readValue(in, velY))
+                truncated();
+            beacon->setHasMobility(true);
+            beacon->setPosX(posX);
+            beacon->setPosY(posY);
+            beacon->setVelX(velX);
+            beacon->setVelY(velY);
+        }
+
+        uint8_t chHops;
+        int32_t parentId;
+        uint16_t m;
+        if (!readValue(in, chHops) || !readValue(in, parentId) || !readValue(in, m))
+            truncated();
+        beacon->setChHops(chHops);
+        beacon->setParentId(parentId);
+        beacon->setSubtreeIdsArraySize(m);
+        for (uint16_t k = 0; k < m; k++) {
+            int32_t subtreeId;
+            if (!readValue(in, subtreeId))
+                truncated();
+            beacon->setSubtreeIds(k, subtreeId);
+        }
+        beacon->setChunkLength(B(byteLength));
+        nextPacket = new Packet(name, beacon);
+    }
+    else if (recordType == TRACE_DATA) {
+        int32_t srcId, destId, seqNo;
+        int64_t sendTimeRaw;
+        int16_t hopLimit;
+        int32_t targetClusterId;
+        uint8_t traceHops, n;
+        if (!readValue(in, srcId) || !readValue(in, destId) || !readValue(in, sendTimeRaw) || !readValue(in, seqNo)
+                || !readValue(in, hopLimit) || !readValue(in, targetClusterId) || !readValue(in, traceHops) || !readValue(in, n))
+            truncated();
+
+        auto data = makePooled<LccData>();
+        data->setSrcId(srcId);
+        data->setDestId(destId);
+        data->setSendTime(SimTime::fromRaw(sendTimeRaw));
+        data->setSeqNo(seqNo);
+        data->setHopLimit(hopLimit);
+        data->setTargetClusterId(targetClusterId);
+        data->setTraceHops(traceHops != 0);
+        for (uint8_t k = 0; k < n; k++) {
+            int32_t hopId;
+            int8_t hopRole, hopKind;
+            int64_t hopTimeRaw;
+            if (!readValue(in, hopId) || !readValue(in, hopRole) || !readValue(in, hopKind) || !readValue(in, hopTimeRaw))
+                truncated();
+            data->appendHopIds(hopId);
+            data->appendHopRoles(hopRole);
+            data->appendHopKinds(hopKind);
+            data->appendHopTimes(SimTime::fromRaw(hopTimeRaw));
+        }
+        data->setChunkLength(B(byteLength));
+        nextPacket = new Packet(name, data);
+    }
+    else if (recordType == TRACE_CLUSTER_CAST) {
+        int32_t srcId, clusterId, seqNo;
+        int8_t kind;
+        uint16_t n;
+        if (!readValue(in, srcId) || !readValue(in, clusterId) || !readValue(in, kind) || !readValue(in, seqNo)
+                || !readValue(in, n))
+            truncated();
+
+        auto cast = makePooled<LccClusterCast>();
+        cast->setSrcId(srcId);
+        cast->setClusterId(clusterId);
+        cast->setKind(kind);
+        cast->setSeqNo(seqNo);
+        cast->setMemberIdsArraySize(n);
+        for (uint16_t k = 0; k < n; k++) {
+            int32_t memberId;
+            if (!readValue(in, memberId))
+                truncated();
+            cast->setMemberIds(k, memberId);
+        }
+        uint16_t m;
+        if (!readValue(in, m))
+            truncated();
+        cast->setMemberValuesArraySize(m);
+        for (uint16_t k = 0; k < m; k++) {
+            int32_t memberValue;
+            if (!readValue(in, memberValue))
+                truncated();
+            cast->setMemberValues(k, memberValue);
+        }
+        int32_t backupChId;
+        if (!readValue(in, backupChId))
+            truncated();
+        cast->setBackupChId(backupChId);
+        cast->setChunkLength(B(byteLength));
+        nextPacket = new Packet(name, cast);
+    }
+    else if (recordType == TRACE_REPORT) {
+        int32_t srcId, clusterId, neighborCount;
+        if (!readValue(in, srcId) || !readValue(in, clusterId) || !readValue(in, neighborCount))
+            truncated();
+
+        auto report = makePooled<LccReport>();
+        report->setSrcId(srcId);
+        report->setClusterId(clusterId);
+        report->setNeighborCount(neighborCount);
+        report->setChunkLength(B(byteLength));
+        nextPacket = new Packet(name, report);
+    }
+    else {
+        throw cRuntimeError("LCC trace: unknown record type %d", (int)recordType);
+    }
+
+    // Link kalitesi replay'de de aynı SNIR değerlerini görsün
+    if (snir >= 0) {
+        auto snirInd = nextPacket->addTag<SnirInd>();
+        snirInd->setMinimumSnir(snir);
+        snirInd->setMaximumSnir(snir);
+    }
+
+    nextArrivalTime = SimTime::fromRaw(arrivalRaw);
+    hasRecord = true;
+    return true;
+}
+
+} // namespace inet
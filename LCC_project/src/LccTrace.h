@@ -0,0 +1,98 @@
+#ifndef __LCCTRACE_H_
+#define __LCCTRACE_H_
+
+#include <omnetpp.h>
+#include "inet/common/packet/Packet.h"
+#include "LCCMessage_m.h"
+#include <fstream>
+#include <string>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC TRACE (Record / Replay)
+// ------------------------------------------------------------------
+// Her node kendi dosyasına, socketDataArrived'a gelen LccBeacon / LccData /
+// LccClusterCast / LccReport paketlerini varış zamanıyla birlikte sıkıştırılmış
+// binary olarak yazar.
+// Replay modunda aynı dosya okunup paketler radyo katmanı olmadan
+// doğrudan socketDataArrived'a verilir.
+//
+// Dosya başlığı: uint32 magic ("LCCT"), uint16 format versiyonu,
+//                int8 simtime ölçek üssü (SimTime::getScaleExp)
+// Kayıt formatı değişince TRACE_FORMAT_VERSION artırılır; eski dosya reddedilir.
+//
+// Kayıt formatı (little-endian, sabit başlık + değişken gövde):
+//   int64  arrivalTime (simtime raw)
+//   uint8  recordType  (TRACE_BEACON / TRACE_DATA / TRACE_CLUSTER_CAST / TRACE_REPORT)
+//   uint32 byteLength, uint8 nameLen, char packetName[nameLen]
+//   double snir        (SnirInd minimum, doğrusal; gösterge yoksa -1)
+//   Beacon: int32 srcId, int8 role, int32 clusterHeadId,
+//           uint16 n, int32 seenClusterIds[n], int32 backupChId,
+//           uint8 flags (1: hasMobility, 2: solicit), [double posX, posY, velX, velY],
+//           uint8 chHops, int32 parentId, uint16 m, int32 subtreeIds[m]
+//   Data:   int32 srcId, int32 destId, int64 sendTime (raw), int32 seqNo,
+//           int16 hopLimit, int32 targetClusterId,
+//           uint8 traceHops, uint8 n,
+//           n x (int32 hopId, int8 hopRole, int8 hopKind, int64 hopTime)
+//   Cast:   int32 srcId, int32 clusterId, int8 kind, int32 seqNo,
+//           uint16 n, int32 memberIds[n], uint16 m, int32 memberValues[m],
+//           int32 backupChId
+//   Report: int32 srcId, int32 clusterId, int32 neighborCount
+
+enum LccTraceRecordType : uint8_t {
+    TRACE_BEACON = 1,
+    TRACE_DATA = 2,
+    TRACE_CLUSTER_CAST = 3,
+    TRACE_REPORT = 4
+};
+
+class LccTraceWriter
+{
+  protected:
+    std::ofstream out;
+
+  public:
+    ~LccTraceWriter() { close(); }
+
+    void open(const std::string& fileName);
+    void close();
+    bool isOpen() const { return out.is_open(); }
+
+    void writeBeacon(simtime_t arrivalTime, const Packet *packet, const LccBeacon& beacon);
+    void writeData(simtime_t arrivalTime, const Packet *packet, const LccData& data);
+    void writeClusterCast(simtime_t arrivalTime, const Packet *packet, const LccClusterCast& cast);
+    void writeReport(simtime_t arrivalTime, const Packet *packet, const LccReport& report);
+};
+
+class LccTraceReader
+{
+  protected:
+    std::ifstream in;
+    bool hasRecord = false;
+    simtime_t nextArrivalTime;
+    Packet *nextPacket = nullptr;
+    std::string fileName;
+
+    bool readNext();
+    [[noreturn]] void truncated() const;
+
+  public:
+    ~LccTraceReader() { close(); }
+
+    void open(const std::string& fileName);
+    void close();
+
+    // Sıradaki kaydın varış zamanı (kayıt kalmadıysa false)
+    bool hasNext() const { return hasRecord; }
+    simtime_t getNextArrivalTime() const { return nextArrivalTime; }
+
+    // Sıradaki paketi çağırana devreder ve bir sonraki kaydı okur
+    Packet *takeNext();
+};
+
+} // namespace inet
+
+#endif
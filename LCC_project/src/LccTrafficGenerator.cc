@@ -0,0 +1,77 @@
+#include "LccTrafficGenerator.h"
+#include <string>
+
+namespace inet {
+
+void LccTrafficGenerator::configure(cComponent *owner)
+{
+    this->owner = owner;
+
+    std::string modelName = owner->par("trafficModel").stdstringValue();
+    if (modelName == "interval") model = INTERVAL;
+    else if (modelName == "cbr") model = CBR;
+    else if (modelName == "poisson") model = POISSON;
+    else if (modelName == "onoff") model = ONOFF;
+    else throw cRuntimeError("Unknown trafficModel '%s' (interval, cbr, poisson, onoff)", modelName.c_str());
+
+    std::string destName = owner->par("destinationModel").stdstringValue();
+    if (destName == "uniform") destinationModel = DEST_UNIFORM;
+    else if (destName == "hotspot") destinationModel = DEST_HOTSPOT;
+    else throw cRuntimeError("Unknown destinationModel '%s' (uniform, hotspot)", destName.c_str());
+
+    hotspotNodes = cStringTokenizer(owner->par("hotspotNodes").stringValue()).asIntVector();
+    hotspotFraction = owner->par("hotspotFraction");
+    if (destinationModel == DEST_HOTSPOT && hotspotNodes.empty())
+        throw cRuntimeError("destinationModel = hotspot requires a non-empty hotspotNodes list");
+
+    if (model == CBR)
+        cbrInterval = owner->par("sendInterval").doubleValue();
+}
+
+simtime_t LccTrafficGenerator::nextInterval(simtime_t now)
+{
+    switch (model) {
+        case CBR:
+            return cbrInterval;
+
+        case POISSON:
+            // Ortalama sendInterval olan üstel dağılım (Poisson varışlar)
+            return owner->exponential(owner->par("sendInterval").doubleValue());
+
+        case ONOFF: {
+            // ON periyodunda sendInterval ile gönder, bitince OFF kadar sus
+            if (!burstStarted || now >= burstEnd) {
+                simtime_t offDuration = burstStarted ? owner->par("offDuration").doubleValue() : 0.0;
+                burstStarted = true;
+                burstEnd = now + offDuration + owner->par("onDuration").doubleValue();
+                if (offDuration > SIMTIME_ZERO)
+                    return offDuration;
+            }
+            return owner->par("sendInterval").doubleValue();
+        }
+
+        case INTERVAL:
+        default:
+            return owner->par("sendInterval").doubleValue();
+    }
+}
+
+int LccTrafficGenerator::pickDestination(int myId, int numHosts) const
+{
+    if (destinationModel == DEST_HOTSPOT && owner->uniform(0, 1) < hotspotFraction) {
+        int candidate = hotspotNodes[owner->intuniform(0, hotspotNodes.size() - 1)];
+        if (candidate != myId && candidate >= 0 && candidate < numHosts)
+            return candidate;
+    }
+
+    int randomNodeIndex = owner->intuniform(0, numHosts - 1);
+    while (randomNodeIndex == myId) randomNodeIndex = owner->intuniform(0, numHosts - 1);
+    return randomNodeIndex;
+}
+
+int LccTrafficGenerator::nextPayloadSize() const
+{
+    return owner->par("payloadSize").intValue();
+}
+
+} // namespace inet
@@ -0,0 +1,53 @@
+#ifndef __LCCTRAFFICGENERATOR_H_
+#define __LCCTRAFFICGENERATOR_H_
+
+#include <omnetpp.h>
+#include <vector>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// ------------------------------------------------------------------
+// LCC TRAFFIC GENERATOR
+// ------------------------------------------------------------------
+// dataTimer'ın bir sonraki tetiklenme zamanını, hedef node'u ve payload
+// boyutunu LCC.ned parametrelerinden üretir. RNG ve (volatile) parametreler
+// sahibi olan modülden okunur, böylece seed-set davranışı aynı kalır.
+//   trafficModel:     interval | cbr | poisson | onoff
+//   destinationModel: uniform | hotspot
+class LccTrafficGenerator
+{
+  public:
+    enum Model { INTERVAL, CBR, POISSON, ONOFF };
+    enum DestinationModel { DEST_UNIFORM, DEST_HOTSPOT };
+
+  protected:
+    cComponent *owner = nullptr;
+    Model model = INTERVAL;
+    DestinationModel destinationModel = DEST_UNIFORM;
+
+    simtime_t cbrInterval;         // CBR: ilk çekilen sendInterval sabit kalır
+    bool burstStarted = false;     // ONOFF: ilk ON periyodu başladı mı
+    simtime_t burstEnd;            // ONOFF: mevcut ON periyodunun bitişi
+    std::vector<int> hotspotNodes;
+    double hotspotFraction = 0;
+
+  public:
+    void configure(cComponent *owner);
+
+    // Bir sonraki data paketine kadar geçecek süre
+    simtime_t nextInterval(simtime_t now);
+
+    // myId dışında bir hedef (Phase 4 / unicast modu)
+    int pickDestination(int myId, int numHosts) const;
+
+    // Payload boyutu (byte)
+    int nextPayloadSize() const;
+
+    Model getModel() const { return model; }
+};
+
+} // namespace inet
+
+#endif
@@ -0,0 +1,82 @@
+#include "LccTxScheduler.h"
+#include <algorithm>
+
+namespace inet {
+
+// simtime çözünürlüğünde yuvarlama yüzünden timer'ın "hazır olmayan" bir anda
+// tekrar tekrar tetiklenmemesi için küçük tolerans
+static const double TOKEN_EPSILON = 1e-9;
+
+void LccTxScheduler::configure(int txClass, double rate, double burst)
+{
+    ClassState& c = classes[txClass];
+    c.rate = rate;
+    c.burst = std::max(1.0, burst);
+    c.tokens = c.burst;
+    c.lastRefill = SIMTIME_ZERO;
+}
+
+void LccTxScheduler::refill(ClassState& c, simtime_t now)
+{
+    if (c.rate <= 0) return;
+    c.tokens = std::min(c.burst, c.tokens + (now - c.lastRefill).dbl() * c.rate);
+    c.lastRefill = now;
+}
+
+bool LccTxScheduler::enqueue(int txClass, Packet *packet, const L3Address& destAddr, simtime_t now)
+{
+    ClassState& c = classes[txClass];
+    if (queueLimit > 0 && (int)c.queue.size() >= queueLimit)
+        return false;
+
+    Entry entry;
+    entry.packet = packet;
+    entry.destAddr = destAddr;
+    entry.txClass = txClass;
+    entry.enqueueTime = now;
+    c.queue.push_back(entry);
+    totalLength++;
+    return true;
+}
+
+bool LccTxScheduler::dequeue(simtime_t now, Entry& entry)
+{
+    for (ClassState& c : classes) {
+        if (c.queue.empty()) continue;
+        refill(c, now);
+        if (c.rate > 0) {
+            if (c.tokens < 1 - TOKEN_EPSILON) continue;   // bu sınıf bekliyor, alt sınıflar servis edilebilir
+            c.tokens = std::max(0.0, c.tokens - 1);
+        }
+        entry = c.queue.front();
+        c.queue.pop_front();
+        totalLength--;
+        return true;
+    }
+    return false;
+}
+
+simtime_t LccTxScheduler::getNextReadyTime(simtime_t now) const
+{
+    simtime_t next = SIMTIME_MAX;
+    for (const ClassState& c : classes) {
+        if (c.queue.empty()) continue;
+        if (c.rate <= 0) return now;
+        double tokens = std::min(c.burst, c.tokens + (now - c.lastRefill).dbl() * c.rate);
+        simtime_t ready = (tokens >= 1 - TOKEN_EPSILON) ? now : now + std::max((1 - tokens) / c.rate, TOKEN_EPSILON);
+        next = std::min(next, ready);
+    }
+    return next;
+}
+
+void LccTxScheduler::clear()
+{
+    for (ClassState& c : classes) {
+        for (Entry& entry : c.queue)
+            delete entry.packet;
+        c.queue.clear();
+    }
+    totalLength = 0;
+}
+
+} // namespace inet
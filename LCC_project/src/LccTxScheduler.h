@@ -0,0 +1,75 @@
+#ifndef __LCCTXSCHEDULER_H_
+#define __LCCTXSCHEDULER_H_
+
+#include <omnetpp.h>
+#include "inet/common/packet/Packet.h"
+#include "inet/networklayer/common/L3AddressResolver.h"
+#include <deque>
+
+using namespace omnetpp;
+
+namespace inet {
+
+// Öncelik sınıfları: küçük değer = yüksek öncelik
+enum LccTxClass {
+    TX_CONTROL = 0,   // Beacon
+    TX_INTRA = 1,     // Cluster içi data (Member <-> CH)
+    TX_INTER = 2,     // Cluster arası (Gateway / Flood / Emergency)
+    NUM_TX_CLASSES = 3
+};
+
+// ------------------------------------------------------------------
+// LCC TX SCHEDULER
+// ------------------------------------------------------------------
+// Socket'e gitmeden önce paketleri sınıf bazlı kuyruklarda tutar.
+// Her sınıfın kendi token bucket'ı vardır (rate = 0: sınırsız); hazır
+// olan en yüksek öncelikli sınıf önce servis edilir. Timer yönetimi
+// LCC'de kalır, bu sınıf sadece kuyruk ve token hesabını yapar.
+class LccTxScheduler
+{
+  public:
+    struct Entry {
+        Packet *packet = nullptr;
+        L3Address destAddr;
+        int txClass = TX_CONTROL;
+        simtime_t enqueueTime;
+    };
+
+  protected:
+    struct ClassState {
+        std::deque<Entry> queue;
+        double rate = 0;       // paket/s (0: sınırsız)
+        double burst = 1;      // bucket kapasitesi (paket)
+        double tokens = 1;
+        simtime_t lastRefill;
+    };
+
+    ClassState classes[NUM_TX_CLASSES];
+    int queueLimit = 0;        // sınıf başına (0: sınırsız)
+    int totalLength = 0;
+
+    void refill(ClassState& c, simtime_t now);
+
+  public:
+    ~LccTxScheduler() { clear(); }
+
+    void configure(int txClass, double rate, double burst);
+    void setQueueLimit(int limit) { queueLimit = limit; }
+
+    // Kuyruk doluysa false döner (paket çağıranda kalır)
+    bool enqueue(int txClass, Packet *packet, const L3Address& destAddr, simtime_t now);
+
+    // Token'ı olan en yüksek öncelikli paketi çıkarır; yoksa false
+    bool dequeue(simtime_t now, Entry& entry);
+
+    // Bekleyen paketlerden birinin token'a kavuşacağı en erken zaman
+    simtime_t getNextReadyTime(simtime_t now) const;
+
+    bool isEmpty() const { return totalLength == 0; }
+    int getLength() const { return totalLength; }
+    void clear();
+};
+
+} // namespace inet
+
+#endif